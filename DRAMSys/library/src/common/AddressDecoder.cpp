@@ -37,6 +37,10 @@
 
 #include <cmath>
 #include <bitset>
+// The parallel bit extract is selected with the CMake option DRAMSYS_DECODER_BMI2
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
 
 #include "AddressDecoder.h"
 #include "utils.h"
@@ -83,6 +87,9 @@ std::vector<unsigned> AddressDecoder::getAttrToVectorFromJson(nlohmann::json obj
 }
 
 AddressDecoder::AddressDecoder(std::string pathToAddressMapping)
+    : AddressDecoder(loadMapping(pathToAddressMapping)) {}
+
+json AddressDecoder::loadMapping(std::string pathToAddressMapping)
 {
     json addrFile = parseJSON(pathToAddressMapping);
     json mapping;
@@ -108,6 +115,11 @@ AddressDecoder::AddressDecoder(std::string pathToAddressMapping)
     else
         mapping = addrFile["CONGEN"];
 
+    return mapping;
+}
+
+AddressDecoder::AddressDecoder(json mapping)
+{
     for (auto xorItem : mapping["XOR"].items())
     {
         auto value = xorItem.value();
@@ -124,6 +136,33 @@ AddressDecoder::AddressDecoder(std::string pathToAddressMapping)
     vColumnBits = getAttrToVectorFromJson(mapping,"COLUMN_BIT");
     vByteBits = getAttrToVectorFromJson(mapping,"BYTE_BIT");
 
+    // The XORs are applied in order, so each target bit is the parity of a set of original address bits
+    std::vector<uint64_t> parityMasks(64);
+    for (unsigned bit = 0; bit < 64; bit++)
+        parityMasks[bit] = UINT64_C(1) << bit;
+    for (auto it : vXor)
+    {
+        if (it.first == it.second)
+            SC_REPORT_FATAL("AddressDecoder", "XOR of an address bit with itself is not supported.");
+        parityMasks[it.first] ^= parityMasks[it.second];
+    }
+    for (unsigned bit = 0; bit < 64; bit++)
+    {
+        if (parityMasks[bit] != (UINT64_C(1) << bit))
+        {
+            xorTargetBits |= UINT64_C(1) << bit;
+            xorParityMasks.push_back(std::pair<unsigned, uint64_t>(bit, parityMasks[bit]));
+        }
+    }
+
+    channelField = compileField(vChannelBits);
+    rankField = compileField(vRankBits);
+    bankGroupField = compileField(vBankGroupBits);
+    bankField = compileField(vBankBits);
+    rowField = compileField(vRowBits);
+    columnField = compileField(vColumnBits);
+    byteField = compileField(vByteBits);
+
     uint64_t channels = (uint64_t)(pow(2.0, vChannelBits.size()) + 0.5);
     uint64_t ranks = (uint64_t)(pow(2.0, vRankBits.size()) + 0.5);
     uint64_t bankgroups = (uint64_t)(pow(2.0, vBankGroupBits.size()) + 0.5);
@@ -150,44 +189,94 @@ AddressDecoder::AddressDecoder(std::string pathToAddressMapping)
         SC_REPORT_FATAL("AddressDecoder", "Memspec and address mapping do not match");
 }
 
-DecodedAddress AddressDecoder::decodeAddress(uint64_t encAddr)
+AddressDecoder::Field AddressDecoder::compileField(const std::vector<unsigned> &bits)
 {
-    if (encAddr > maximumAddress)
-        SC_REPORT_WARNING("AddressDecoder", ("Address " + std::to_string(encAddr) + " out of range (maximum address is " + std::to_string(maximumAddress) + ")").c_str());
-
-    // Apply XOR
-    // For each used xor:
-    //   Get the first bit and second bit. Apply a bitwise xor operator and save it back to the first bit.
-    for (auto it = vXor.begin(); it != vXor.end(); it++)
+    Field field;
+    for (unsigned it = 0; it < bits.size(); it++)
     {
-        uint64_t xoredBit;
-        xoredBit = (((encAddr >> it->first) & UINT64_C(1)) ^ ((encAddr >> it->second) & UINT64_C(1)));
-        encAddr &= ~(UINT64_C(1) << it->first);
-        encAddr |= xoredBit << it->first;
+        field.mask |= UINT64_C(1) << bits[it];
+        if (it > 0 && bits[it] <= bits[it - 1])
+            field.ascending = false;
     }
 
-    DecodedAddress decAddr;
+    // byteTables[256 * k + value] holds the field bits contained in value as the k-th used byte of the address,
+    // bytes without field bits get no table
+    for (unsigned byteIndex = 0; byteIndex < 8; byteIndex++)
+    {
+        if (((field.mask >> (8 * byteIndex)) & 0xFF) == 0)
+            continue;
 
-    for (unsigned it = 0; it < vChannelBits.size(); it++)
-        decAddr.channel |= ((encAddr >> vChannelBits[it]) & UINT64_C(1)) << it;
+        std::vector<unsigned> table(256, 0);
+        for (unsigned it = 0; it < bits.size(); it++)
+        {
+            if (bits[it] / 8 != byteIndex)
+                continue;
+            unsigned bitInByte = bits[it] % 8;
+            for (unsigned value = 0; value < 256; value++)
+            {
+                if ((value >> bitInByte) & 1)
+                    table[value] |= 1u << it;
+            }
+        }
+        field.byteShifts.push_back(8 * byteIndex);
+        field.byteTables.insert(field.byteTables.end(), table.begin(), table.end());
+    }
+    return field;
+}
 
-    for (unsigned it = 0; it < vRankBits.size(); it++)
-        decAddr.rank |= ((encAddr >> vRankBits[it]) & UINT64_C(1)) << it;
+unsigned AddressDecoder::extractField(const Field &field, uint64_t address)
+{
+#if defined(__BMI2__)
+    if (field.ascending)
+        return static_cast<unsigned>(_pext_u64(address, field.mask));
+#endif
+    unsigned result = 0;
+    for (unsigned it = 0; it < field.byteShifts.size(); it++)
+        result |= field.byteTables[256 * it + ((address >> field.byteShifts[it]) & 0xFF)];
+    return result;
+}
 
-    for (unsigned it = 0; it < vBankGroupBits.size(); it++)
-        decAddr.bankgroup |= ((encAddr >> vBankGroupBits[it]) & UINT64_C(1)) << it;
+unsigned AddressDecoder::parity(uint64_t value)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_parityll(value));
+#else
+    value ^= value >> 32;
+    value ^= value >> 16;
+    value ^= value >> 8;
+    value ^= value >> 4;
+    value ^= value >> 2;
+    value ^= value >> 1;
+    return static_cast<unsigned>(value & 1);
+#endif
+}
 
-    for (unsigned it = 0; it < vBankBits.size(); it++)
-        decAddr.bank |= ((encAddr >> vBankBits[it]) & UINT64_C(1)) << it;
+void AddressDecoder::reportAddressOutOfRange(uint64_t address) const
+{
+    SC_REPORT_WARNING("AddressDecoder", ("Address " + std::to_string(address) + " out of range (maximum address is "
+                                         + std::to_string(maximumAddress) + ")").c_str());
+}
+
+DecodedAddress AddressDecoder::decodeAddress(uint64_t encAddr)
+{
+    if (encAddr > maximumAddress)
+        reportAddressOutOfRange(encAddr);
 
-    for (unsigned it = 0; it < vRowBits.size(); it++)
-        decAddr.row |= ((encAddr >> vRowBits[it]) & UINT64_C(1)) << it;
+    // Apply XOR
+    // Each target bit of the XORs is replaced by the parity of the original address bits in its mask.
+    uint64_t xoredAddr = encAddr & ~xorTargetBits;
+    for (auto it : xorParityMasks)
+        xoredAddr |= static_cast<uint64_t>(parity(encAddr & it.second)) << it.first;
 
-    for (unsigned it = 0; it < vColumnBits.size(); it++)
-        decAddr.column |= ((encAddr >> vColumnBits[it]) & UINT64_C(1)) << it;
+    DecodedAddress decAddr;
 
-    for (unsigned it = 0; it < vByteBits.size(); it++)
-        decAddr.byte |= ((encAddr >> vByteBits[it]) & UINT64_C(1)) << it;
+    decAddr.channel = extractField(channelField, xoredAddr);
+    decAddr.rank = extractField(rankField, xoredAddr);
+    decAddr.bankgroup = extractField(bankGroupField, xoredAddr);
+    decAddr.bank = extractField(bankField, xoredAddr);
+    decAddr.row = extractField(rowField, xoredAddr);
+    decAddr.column = extractField(columnField, xoredAddr);
+    decAddr.byte = extractField(byteField, xoredAddr);
 
     decAddr.bankgroup = decAddr.bankgroup + decAddr.rank * bankgroupsPerRank;
     decAddr.bank = decAddr.bank + decAddr.bankgroup * banksPerGroup;
@@ -195,6 +284,39 @@ DecodedAddress AddressDecoder::decodeAddress(uint64_t encAddr)
     return decAddr;
 }
 
+uint64_t AddressDecoder::depositField(const std::vector<unsigned> &bits, unsigned value)
+{
+    uint64_t address = 0;
+    for (unsigned it = 0; it < bits.size(); it++)
+        address |= static_cast<uint64_t>((value >> it) & 1) << bits[it];
+    return address;
+}
+
+uint64_t AddressDecoder::encodeAddress(const DecodedAddress &decAddr)
+{
+    unsigned bankgroup = decAddr.bankgroup % bankgroupsPerRank;
+    unsigned bank = decAddr.bank % banksPerGroup;
+
+    uint64_t encAddr = depositField(vChannelBits, decAddr.channel)
+            | depositField(vRankBits, decAddr.rank)
+            | depositField(vBankGroupBits, bankgroup)
+            | depositField(vBankBits, bank)
+            | depositField(vRowBits, decAddr.row)
+            | depositField(vColumnBits, decAddr.column)
+            | depositField(vByteBits, decAddr.byte);
+
+    // Undo the XORs: each XOR is its own inverse, so they are applied again in reverse order.
+    for (auto it = vXor.rbegin(); it != vXor.rend(); it++)
+        encAddr ^= ((encAddr >> it->second) & UINT64_C(1)) << it->first;
+
+    return encAddr;
+}
+
+uint64_t AddressDecoder::getMaximumAddress() const
+{
+    return maximumAddress;
+}
+
 void AddressDecoder::print()
 {
     std::cout << headline << std::endl;
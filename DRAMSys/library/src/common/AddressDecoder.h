@@ -71,12 +71,18 @@ class AddressDecoder
 {
 public:
     AddressDecoder(std::string);
+    AddressDecoder(nlohmann::json mapping);
+    // Returns the mapping with ID 0 of an address mapping file
+    static nlohmann::json loadMapping(std::string pathToAddressMapping);
     DecodedAddress decodeAddress(uint64_t addr);
+    // Inverse of decodeAddress (bank groups and banks are numbered globally as in the decoded address)
+    uint64_t encodeAddress(const DecodedAddress &decAddr);
     void print();
+    uint64_t getMaximumAddress() const;
 
 private:
-    std::vector<unsigned> getAttrToVectorFromJson(nlohmann::json obj, std::string strName);
-    unsigned int getUnsignedAttrFromJson(nlohmann::json obj, std::string strName);
+    static std::vector<unsigned> getAttrToVectorFromJson(nlohmann::json obj, std::string strName);
+    static unsigned int getUnsignedAttrFromJson(nlohmann::json obj, std::string strName);
 
     unsigned banksPerGroup;
     unsigned bankgroupsPerRank;
@@ -92,6 +98,29 @@ private:
     std::vector<unsigned> vRowBits;
     std::vector<unsigned> vColumnBits;
     std::vector<unsigned> vByteBits;
+
+    // The mapping compiled into masks at construction:
+    // Each address bit that is the target of XORs is replaced by the parity of the address bits in its mask.
+    uint64_t xorTargetBits = 0;
+    std::vector<std::pair<unsigned, uint64_t>> xorParityMasks;
+
+    struct Field
+    {
+        // All address bits of the field
+        uint64_t mask = 0;
+        // True if the field bits are in ascending order, i.e., a parallel bit extract yields the field
+        bool ascending = true;
+        // Portable lookup tables with the field bits of each address byte that contains field bits (256 entries each)
+        std::vector<unsigned> byteShifts;
+        std::vector<unsigned> byteTables;
+    };
+    Field channelField, rankField, bankGroupField, bankField, rowField, columnField, byteField;
+
+    static Field compileField(const std::vector<unsigned> &bits);
+    static unsigned extractField(const Field &field, uint64_t address);
+    static unsigned parity(uint64_t value);
+    static uint64_t depositField(const std::vector<unsigned> &bits, unsigned value);
+    void reportAddressOutOfRange(uint64_t address) const;
 };
 
 #endif // ADDRESSDECODER_H
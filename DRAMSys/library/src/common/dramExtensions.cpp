@@ -152,9 +152,22 @@ uint64_t DramExtension::getPayloadID(const tlm_generic_payload &payload)
     return DramExtension::getPayloadID(&payload);
 }
 
+uint64_t DramExtension::getThreadPayloadID(const tlm_generic_payload *payload)
+{
+    return DramExtension::getExtension(payload).getThreadPayloadID();
+}
+
+uint64_t DramExtension::getThreadPayloadID(const tlm_generic_payload &payload)
+{
+    return DramExtension::getThreadPayloadID(&payload);
+}
+
 tlm_extension_base *DramExtension::clone() const
 {
-    return new DramExtension(thread, channel, rank, bankgroup, bank, row, column, burstlength, payloadID);
+    DramExtension *extension = new DramExtension(thread, channel, rank, bankgroup, bank, row, column,
+                                                 burstlength, payloadID);
+    extension->threadPayloadID = threadPayloadID;
+    return extension;
 }
 
 void DramExtension::copy_from(const tlm_extension_base &ext)
@@ -168,6 +181,8 @@ void DramExtension::copy_from(const tlm_extension_base &ext)
     row = cpyFrom.row;
     column = cpyFrom.column;
     burstlength = cpyFrom.burstlength;
+    payloadID = cpyFrom.payloadID;
+    threadPayloadID = cpyFrom.threadPayloadID;
 }
 
 Thread DramExtension::getThread() const
@@ -215,6 +230,16 @@ uint64_t DramExtension::getPayloadID() const
     return payloadID;
 }
 
+uint64_t DramExtension::getThreadPayloadID() const
+{
+    return threadPayloadID;
+}
+
+void DramExtension::setThreadPayloadID(uint64_t threadPayloadID)
+{
+    this->threadPayloadID = threadPayloadID;
+}
+
 void DramExtension::incrementRow()
 {
     ++row;
@@ -250,6 +275,60 @@ sc_time GenerationExtension::getTimeOfGeneration(const tlm_generic_payload &payl
     return GenerationExtension::getTimeOfGeneration(&payload);
 }
 
+tlm_extension_base *PriorityExtension::clone() const
+{
+    return new PriorityExtension(priority, weight);
+}
+
+void PriorityExtension::copy_from(const tlm_extension_base &ext)
+{
+    const PriorityExtension &cpyFrom = static_cast<const PriorityExtension &>(ext);
+    priority = cpyFrom.priority;
+    weight = cpyFrom.weight;
+}
+
+// Payloads without extension have the lowest priority and weight 1
+unsigned int PriorityExtension::getPriority(const tlm_generic_payload *payload)
+{
+    PriorityExtension *result = NULL;
+    payload->get_extension(result);
+    return (result != NULL) ? result->priority : 0;
+}
+
+unsigned int PriorityExtension::getWeight(const tlm_generic_payload *payload)
+{
+    PriorityExtension *result = NULL;
+    payload->get_extension(result);
+    return (result != NULL) ? result->weight : 1;
+}
+
+tlm_extension_base *SubRequestExtension::clone() const
+{
+    SubRequestExtension *extension = new SubRequestExtension();
+    extension->parent = parent;
+    return extension;
+}
+
+void SubRequestExtension::copy_from(const tlm_extension_base &ext)
+{
+    const SubRequestExtension &cpyFrom = static_cast<const SubRequestExtension &>(ext);
+    parent = cpyFrom.parent;
+}
+
+tlm_extension_base *SplitRequestExtension::clone() const
+{
+    return new SplitRequestExtension(*this);
+}
+
+void SplitRequestExtension::copy_from(const tlm_extension_base &ext)
+{
+    const SplitRequestExtension &cpyFrom = static_cast<const SplitRequestExtension &>(ext);
+    isSplit = cpyFrom.isSplit;
+    pendingEndReqs = cpyFrom.pendingEndReqs;
+    pendingResponses = cpyFrom.pendingResponses;
+    responseStatus = cpyFrom.responseStatus;
+}
+
 //THREAD
 bool operator ==(const Thread &lhs, const Thread &rhs)
 {
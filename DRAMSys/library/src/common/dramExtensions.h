@@ -193,6 +193,8 @@ public:
     static Column getColumn(const tlm::tlm_generic_payload &payload);
     static uint64_t getPayloadID(const tlm::tlm_generic_payload *payload);
     static uint64_t getPayloadID(const tlm::tlm_generic_payload &payload);
+    static uint64_t getThreadPayloadID(const tlm::tlm_generic_payload *payload);
+    static uint64_t getThreadPayloadID(const tlm::tlm_generic_payload &payload);
 
     Thread getThread() const;
     Channel getChannel() const;
@@ -204,6 +206,8 @@ public:
 
     unsigned int getBurstlength() const;
     uint64_t getPayloadID() const;
+    uint64_t getThreadPayloadID() const;
+    void setThreadPayloadID(uint64_t threadPayloadID);
     void incrementRow();
 
 private:
@@ -216,6 +220,8 @@ private:
     Column column;
     unsigned int burstlength;
     uint64_t payloadID;
+    // Sequence number of the payload among all payloads of its thread
+    uint64_t threadPayloadID = 0;
 };
 
 
@@ -243,6 +249,51 @@ private:
 };
 
 
+// Optional quality of service information of the initiator, used by the arbitration policies of the arbiter.
+// A higher priority is served first, the weight is the share of the initiator in weighted round-robin.
+class PriorityExtension : public tlm::tlm_extension<PriorityExtension>
+{
+public:
+    PriorityExtension(unsigned int priority, unsigned int weight)
+        : priority(priority), weight(weight) {}
+    virtual tlm::tlm_extension_base *clone() const;
+    virtual void copy_from(const tlm::tlm_extension_base &ext);
+    static unsigned int getPriority(const tlm::tlm_generic_payload *payload);
+    static unsigned int getWeight(const tlm::tlm_generic_payload *payload);
+
+private:
+    unsigned int priority;
+    unsigned int weight;
+};
+
+// Links a burst-sized sub-request created by the arbiter to the original request
+class SubRequestExtension : public tlm::tlm_extension<SubRequestExtension>
+{
+public:
+    SubRequestExtension() : parent(nullptr) {}
+    virtual tlm::tlm_extension_base *clone() const;
+    virtual void copy_from(const tlm::tlm_extension_base &ext);
+
+    tlm::tlm_generic_payload *parent;
+};
+
+// State of an original request that the arbiter has split into sub-requests
+class SplitRequestExtension : public tlm::tlm_extension<SplitRequestExtension>
+{
+public:
+    SplitRequestExtension() : isSplit(false), pendingEndReqs(0), pendingResponses(0),
+        responseStatus(tlm::TLM_OK_RESPONSE) {}
+    virtual tlm::tlm_extension_base *clone() const;
+    virtual void copy_from(const tlm::tlm_extension_base &ext);
+
+    bool isSplit;
+    unsigned int pendingEndReqs;
+    unsigned int pendingResponses;
+    // Worst response status of all sub-requests answered so far
+    tlm::tlm_response_status responseStatus;
+};
+
+
 bool operator==(const Thread &lhs, const Thread &rhs);
 bool operator!=(const Thread &lhs, const Thread &rhs);
 bool operator<(const Thread &lhs, const Thread &rhs);
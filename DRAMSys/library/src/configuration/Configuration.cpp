@@ -86,12 +86,32 @@ void Configuration::setParameter(std::string name, nlohmann::json value)
         scheduler = value;
     else if (name == "RequestBufferSize")
         requestBufferSize = value;
+    else if (name == "RequestBufferPolicy")
+        requestBufferPolicy = value;
+    else if (name == "RequestBufferSizeBank")
+        requestBufferSizeBank = value;
+    else if (name == "RequestBufferSizeRank")
+        requestBufferSizeRank = value;
+    else if (name == "RequestBufferSizeRead")
+        requestBufferSizeRead = value;
+    else if (name == "RequestBufferSizeWrite")
+        requestBufferSizeWrite = value;
+    else if (name == "WriteDrainHighWatermark")
+        writeDrainHighWatermark = value;
+    else if (name == "WriteDrainLowWatermark")
+        writeDrainLowWatermark = value;
+    else if (name == "BlissThreshold")
+        blissThreshold = value;
+    else if (name == "BlissClearingInterval")
+        blissClearingInterval = value;
     else if (name == "CmdMux")
         cmdMux = value;
     else if (name == "RespQueue")
         respQueue = value;
     else if (name == "RefreshPolicy")
         refreshPolicy = value;
+    else if (name == "RefreshBankSelection")
+        refreshBankSelection = value;
     else if (name == "RefreshMaxPostponed")
         refreshMaxPostponed = value;
     else if (name == "RefreshMaxPulledin")
@@ -100,6 +120,12 @@ void Configuration::setParameter(std::string name, nlohmann::json value)
         powerDownPolicy = value;
     else if (name == "PowerDownTimeout")
         powerDownTimeout = value;
+    else if (name == "ControllerMode")
+        controllerMode = value;
+    else if (name == "Checker")
+        checker = value;
+    else if (name == "RequestCredits")
+        requestCredits = value;
     //SimConfig------------------------------------------------
     else if (name == "SimulationName")
         simulationName = value;
@@ -133,6 +159,12 @@ void Configuration::setParameter(std::string name, nlohmann::json value)
     }
     else if (name == "UseMalloc")
         useMalloc = value;
+    else if (name == "ArbitrationPolicy")
+        arbitrationPolicy = value;
+    else if (name == "ArbitrationAgingThreshold")
+        arbitrationAgingThreshold = value;
+    else if (name == "ReorderResponses")
+        reorderResponses = value;
     else if (name == "CheckTLM2Protocol")
         checkTLM2Protocol = value;
     else if (name == "ECCControllerMode")
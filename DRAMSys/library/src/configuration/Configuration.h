@@ -74,11 +74,24 @@ public:
     std::string cmdMux = "Oldest";
     std::string respQueue = "Fifo";
     unsigned int requestBufferSize = 8;
+    std::string requestBufferPolicy = "Bankwise";
+    unsigned int requestBufferSizeBank = 0;
+    unsigned int requestBufferSizeRank = 0;
+    unsigned int requestBufferSizeRead = 0;
+    unsigned int requestBufferSizeWrite = 0;
+    unsigned int writeDrainHighWatermark = 16;
+    unsigned int writeDrainLowWatermark = 8;
+    unsigned int blissThreshold = 4;
+    unsigned int blissClearingInterval = 10000;
     std::string refreshPolicy = "Rankwise";
+    std::string refreshBankSelection = "Sequential";
     unsigned int refreshMaxPostponed = 0;
     unsigned int refreshMaxPulledin = 0;
     std::string powerDownPolicy = "NoPowerDown";
     unsigned int powerDownTimeout = 3;
+    std::string controllerMode = "Polling";
+    std::string checker = "Standard";
+    unsigned int requestCredits = 0;
 
     // SimConfig
     std::string simulationName = "default";
@@ -95,6 +108,9 @@ public:
     bool gem5 = false;
     bool useMalloc = false;
     unsigned long long int addressOffset = 0;
+    std::string arbitrationPolicy = "Fifo";
+    unsigned int arbitrationAgingThreshold = 1000;
+    bool reorderResponses = false;
 
     // MemSpec (from DRAM-Power)
     MemSpec *memSpec;
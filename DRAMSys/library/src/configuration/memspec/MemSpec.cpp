@@ -74,3 +74,22 @@ sc_time MemSpec::getCommandLength(Command command) const
 {
     return tCK * commandLengthInCycles[command];
 }
+
+uint64_t MemSpec::timeToCycles(sc_time time) const
+{
+    if (time == sc_max_time())
+        return MAX_CYCLE;
+    return (time.value() + tCK.value() / 2) / tCK.value();
+}
+
+sc_time MemSpec::cyclesToTime(uint64_t cycles) const
+{
+    if (cycles == MAX_CYCLE)
+        return sc_max_time();
+    return tCK * cycles;
+}
+
+uint64_t MemSpec::getCurrentCycle() const
+{
+    return timeToCycles(sc_time_stamp());
+}
@@ -79,6 +79,11 @@ public:
 
     sc_time getCommandLength(Command) const;
 
+    // The controller works on clock cycles internally, all its timings are multiples of tCK
+    uint64_t timeToCycles(sc_time) const;
+    sc_time cyclesToTime(uint64_t) const;
+    uint64_t getCurrentCycle() const;
+
 protected:
     MemSpec(nlohmann::json &memspec, unsigned numberOfChannels,
             unsigned numberOfRanks, unsigned banksPerRank,
@@ -36,17 +36,17 @@
 
 using namespace tlm;
 
-BankMachine::BankMachine(SchedulerIF *scheduler, CheckerIF *checker, Bank bank)
-    : scheduler(scheduler), checker(checker), bank(bank)
+BankMachine::BankMachine(SchedulerIF *scheduler, RankTimingBatch *timingBatch, Bank bank)
+    : scheduler(scheduler), timingBatch(timingBatch), bank(bank)
 {
     MemSpec *memSpec = Configuration::getInstance().memSpec;
     rank = Rank(bank.ID() / memSpec->banksPerRank);
     bankgroup = BankGroup(bank.ID() / memSpec->banksPerGroup);
 }
 
-std::tuple<Command, tlm_generic_payload *, sc_time> BankMachine::getNextCommand()
+CommandCandidate BankMachine::getNextCommand()
 {
-        return std::tuple<Command, tlm_generic_payload *, sc_time>(nextCommand, currentPayload, timeToSchedule);
+        return CommandCandidate{nextCommand, currentPayload, timeToSchedule};
 }
 
 void BankMachine::updateState(Command command)
@@ -115,12 +115,12 @@ bool BankMachine::isIdle()
     return (currentPayload == nullptr);
 }
 
-BankMachineOpen::BankMachineOpen(SchedulerIF *scheduler, CheckerIF *checker, Bank bank)
-    : BankMachine(scheduler, checker, bank) {}
+BankMachineOpen::BankMachineOpen(SchedulerIF *scheduler, RankTimingBatch *timingBatch, Bank bank)
+    : BankMachine(scheduler, timingBatch, bank) {}
 
-sc_time BankMachineOpen::start()
+uint64_t BankMachineOpen::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
     if (sleeping)
@@ -133,7 +133,7 @@ sc_time BankMachineOpen::start()
     if (currentState == BmState::Precharged && !blocked) // row miss
     {
         nextCommand = Command::ACT;
-        timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+        timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
     }
     else if (currentState == BmState::Activated)
     {
@@ -146,23 +146,23 @@ sc_time BankMachineOpen::start()
             else
                 SC_REPORT_FATAL("BankMachine", "Wrong TLM command");
 
-            timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+            timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
         }
         else if (!blocked) // row miss
         {
             nextCommand = Command::PRE;
-            timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+            timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
         }
     }
     return timeToSchedule;
 }
 
-BankMachineClosed::BankMachineClosed(SchedulerIF *scheduler, CheckerIF *checker, Bank bank)
-    : BankMachine(scheduler, checker, bank) {}
+BankMachineClosed::BankMachineClosed(SchedulerIF *scheduler, RankTimingBatch *timingBatch, Bank bank)
+    : BankMachine(scheduler, timingBatch, bank) {}
 
-sc_time BankMachineClosed::start()
+uint64_t BankMachineClosed::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
     if (sleeping)
@@ -175,7 +175,7 @@ sc_time BankMachineClosed::start()
     if (currentState == BmState::Precharged && !blocked) // row miss
     {
         nextCommand = Command::ACT;
-        timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+        timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
     }
     else if (currentState == BmState::Activated)
     {
@@ -186,17 +186,17 @@ sc_time BankMachineClosed::start()
         else
             SC_REPORT_FATAL("BankMachine", "Wrong TLM command");
 
-        timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+        timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
     }
     return timeToSchedule;
 }
 
-BankMachineOpenAdaptive::BankMachineOpenAdaptive(SchedulerIF *scheduler, CheckerIF *checker, Bank bank)
-    : BankMachine(scheduler, checker, bank) {}
+BankMachineOpenAdaptive::BankMachineOpenAdaptive(SchedulerIF *scheduler, RankTimingBatch *timingBatch, Bank bank)
+    : BankMachine(scheduler, timingBatch, bank) {}
 
-sc_time BankMachineOpenAdaptive::start()
+uint64_t BankMachineOpenAdaptive::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
     if (sleeping)
@@ -209,7 +209,7 @@ sc_time BankMachineOpenAdaptive::start()
     if (currentState == BmState::Precharged && !blocked) // row miss
     {
         nextCommand = Command::ACT;
-        timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+        timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
     }
     else if (currentState == BmState::Activated)
     {
@@ -233,23 +233,23 @@ sc_time BankMachineOpenAdaptive::start()
                 else
                     SC_REPORT_FATAL("BankMachine", "Wrong TLM command");               
             }
-            timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+            timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
         }
         else if (!blocked) // row miss
         {
             nextCommand = Command::PRE;
-            timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+            timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
         }
     }
     return timeToSchedule;
 }
 
-BankMachineClosedAdaptive::BankMachineClosedAdaptive(SchedulerIF *scheduler, CheckerIF *checker, Bank bank)
-    : BankMachine(scheduler, checker, bank) {}
+BankMachineClosedAdaptive::BankMachineClosedAdaptive(SchedulerIF *scheduler, RankTimingBatch *timingBatch, Bank bank)
+    : BankMachine(scheduler, timingBatch, bank) {}
 
-sc_time BankMachineClosedAdaptive::start()
+uint64_t BankMachineClosedAdaptive::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
     if (sleeping)
@@ -262,7 +262,7 @@ sc_time BankMachineClosedAdaptive::start()
     if (currentState == BmState::Precharged && !blocked) // row miss
     {
         nextCommand = Command::ACT;
-        timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+        timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
     }
     else if (currentState == BmState::Activated)
     {
@@ -286,12 +286,12 @@ sc_time BankMachineClosedAdaptive::start()
                 else
                     SC_REPORT_FATAL("BankMachine", "Wrong TLM command");
             }
-            timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+            timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
         }
         else if (!blocked) // row miss TODO: remove this, can never happen
         {
             nextCommand = Command::PRE;
-            timeToSchedule = checker->timeToSatisfyConstraints(nextCommand, rank, bankgroup, bank);
+            timeToSchedule = timingBatch->timeToSatisfyConstraints(nextCommand, bankgroup, bank);
             SC_REPORT_FATAL("BankMachine", "Should never be reached for this policy");
         }
     }
@@ -42,10 +42,10 @@
 #include "Controller.h"
 #include "Command.h"
 #include "scheduler/SchedulerIF.h"
-#include "checker/CheckerIF.h"
+#include "checker/RankTimingBatch.h"
 
 class SchedulerIF;
-class CheckerIF;
+class RankTimingBatch;
 
 enum class BmState
 {
@@ -57,8 +57,8 @@ class BankMachine
 {
 public:
     virtual ~BankMachine() {}
-    virtual sc_time start() = 0;
-    std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand();
+    virtual uint64_t start() = 0;
+    CommandCandidate getNextCommand();
     void updateState(Command);
     void block();
 
@@ -70,14 +70,14 @@ public:
     bool isIdle();
 
 protected:
-    BankMachine(SchedulerIF *, CheckerIF *, Bank);
+    BankMachine(SchedulerIF *, RankTimingBatch *, Bank);
     tlm::tlm_generic_payload *currentPayload = nullptr;
     SchedulerIF *scheduler;
-    CheckerIF *checker;
+    RankTimingBatch *timingBatch;
     Command nextCommand = Command::NOP;
     BmState currentState = BmState::Precharged;
     Row currentRow;
-    sc_time timeToSchedule = sc_max_time();
+    uint64_t timeToSchedule = MAX_CYCLE;
     Rank rank = Rank(0);
     BankGroup bankgroup = BankGroup(0);
     Bank bank;
@@ -88,29 +88,29 @@ protected:
 class BankMachineOpen final : public BankMachine
 {
 public:
-    BankMachineOpen(SchedulerIF *, CheckerIF *, Bank);
-    sc_time start();
+    BankMachineOpen(SchedulerIF *, RankTimingBatch *, Bank);
+    uint64_t start();
 };
 
 class BankMachineClosed final : public BankMachine
 {
 public:
-    BankMachineClosed(SchedulerIF *, CheckerIF *, Bank);
-    sc_time start();
+    BankMachineClosed(SchedulerIF *, RankTimingBatch *, Bank);
+    uint64_t start();
 };
 
 class BankMachineOpenAdaptive final : public BankMachine
 {
 public:
-    BankMachineOpenAdaptive(SchedulerIF *, CheckerIF *, Bank);
-    sc_time start();
+    BankMachineOpenAdaptive(SchedulerIF *, RankTimingBatch *, Bank);
+    uint64_t start();
 };
 
 class BankMachineClosedAdaptive final : public BankMachine
 {
 public:
-    BankMachineClosedAdaptive(SchedulerIF *, CheckerIF *, Bank);
-    sc_time start();
+    BankMachineClosedAdaptive(SchedulerIF *, RankTimingBatch *, Bank);
+    uint64_t start();
 };
 
 #endif // BANKMACHINE_H
@@ -39,6 +39,7 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <cstdint>
 #include <tlm.h>
 #include "../common/third_party/DRAMPower/src/MemCommand.h"
 
@@ -89,6 +90,16 @@ enum Command
     SREFEX
 };
 
+// Controller-internal time is measured in clock cycles (see MemSpec::timeToCycles)
+constexpr uint64_t MAX_CYCLE = UINT64_MAX;
+
+struct CommandCandidate
+{
+    Command command;
+    tlm::tlm_generic_payload *payload;
+    uint64_t timeToSchedule;
+};
+
 std::string commandToString(Command);
 tlm::tlm_phase commandToPhase(Command);
 Command phaseToCommand(tlm::tlm_phase);
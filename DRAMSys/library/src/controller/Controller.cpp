@@ -34,6 +34,8 @@
 
 #include "Controller.h"
 
+#include <algorithm>
+#include <cstring>
 #include "../configuration/Configuration.h"
 #include "../common/dramExtensions.h"
 #include "Command.h"
@@ -46,9 +48,19 @@
 #include "checker/CheckerGDDR5.h"
 #include "checker/CheckerGDDR5X.h"
 #include "checker/CheckerGDDR6.h"
+#include "checker/CheckerTableDDR3.h"
+#include "checker/CheckerTableDDR4.h"
+#include "checker/CheckerTableLPDDR4.h"
+#include "checker/CheckerTableWideIO.h"
+#include "checker/CheckerTableWideIO2.h"
+#include "checker/CheckerDebug.h"
 #include "scheduler/SchedulerFifo.h"
 #include "scheduler/SchedulerFrFcfs.h"
 #include "scheduler/SchedulerFrFcfsGrp.h"
+#include "scheduler/SchedulerWriteDrain.h"
+#include "scheduler/SchedulerBliss.h"
+#include "scheduler/BufferCounterBankwise.h"
+#include "scheduler/BufferCounterShared.h"
 #include "cmdmux/CmdMuxStrict.h"
 #include "cmdmux/CmdMuxOldest.h"
 #include "respqueue/RespQueueFifo.h"
@@ -72,26 +84,53 @@ Controller::Controller(sc_module_name name) :
     ranksNumberOfPayloads = std::vector<unsigned>(memSpec->numberOfRanks);
 
     // instantiate timing checker
-    if (memSpec->memoryType == "DDR3")
-        checker = new CheckerDDR3();
-    else if (memSpec->memoryType == "DDR4")
-        checker = new CheckerDDR4();
-    else if (memSpec->memoryType == "WIDEIO_SDR")
-        checker = new CheckerWideIO();
-    else if (memSpec->memoryType == "LPDDR4")
-        checker = new CheckerLPDDR4();
-    else if (memSpec->memoryType == "WIDEIO2")
-        checker = new CheckerWideIO2();
-    else if (memSpec->memoryType == "HBM2")
-        checker = new CheckerHBM2();
-    else if (memSpec->memoryType == "GDDR5")
-        checker = new CheckerGDDR5();
-    else if (memSpec->memoryType == "GDDR5X")
-        checker = new CheckerGDDR5X();
-    else if (memSpec->memoryType == "GDDR6")
-        checker = new CheckerGDDR6();
-    else
+    auto createStandardChecker = [&]() -> CheckerIF *
+    {
+        if (memSpec->memoryType == "DDR3")
+            return new CheckerDDR3(currentCycle);
+        else if (memSpec->memoryType == "DDR4")
+            return new CheckerDDR4(currentCycle);
+        else if (memSpec->memoryType == "WIDEIO_SDR")
+            return new CheckerWideIO(currentCycle);
+        else if (memSpec->memoryType == "LPDDR4")
+            return new CheckerLPDDR4(currentCycle);
+        else if (memSpec->memoryType == "WIDEIO2")
+            return new CheckerWideIO2(currentCycle);
+        else if (memSpec->memoryType == "HBM2")
+            return new CheckerHBM2(currentCycle);
+        else if (memSpec->memoryType == "GDDR5")
+            return new CheckerGDDR5(currentCycle);
+        else if (memSpec->memoryType == "GDDR5X")
+            return new CheckerGDDR5X(currentCycle);
+        else if (memSpec->memoryType == "GDDR6")
+            return new CheckerGDDR6(currentCycle);
         SC_REPORT_FATAL("Controller", "Unsupported DRAM type!");
+        return nullptr;
+    };
+    auto createTableChecker = [&]() -> CheckerIF *
+    {
+        if (memSpec->memoryType == "DDR3")
+            return new CheckerTableDDR3(currentCycle);
+        else if (memSpec->memoryType == "DDR4")
+            return new CheckerTableDDR4(currentCycle);
+        else if (memSpec->memoryType == "WIDEIO_SDR")
+            return new CheckerTableWideIO(currentCycle);
+        else if (memSpec->memoryType == "LPDDR4")
+            return new CheckerTableLPDDR4(currentCycle);
+        else if (memSpec->memoryType == "WIDEIO2")
+            return new CheckerTableWideIO2(currentCycle);
+        SC_REPORT_FATAL("Controller", "Table-driven checker not supported for this DRAM type!");
+        return nullptr;
+    };
+
+    if (config.checker == "Standard")
+        checker = createStandardChecker();
+    else if (config.checker == "TableDriven")
+        checker = createTableChecker();
+    else if (config.checker == "Debug")
+        checker = new CheckerDebug(currentCycle, createStandardChecker(), createTableChecker());
+    else
+        SC_REPORT_FATAL("Controller", "Selected checker not supported!");
 
     // instantiate scheduler and command mux
     if (config.scheduler == "Fifo")
@@ -100,9 +139,20 @@ Controller::Controller(sc_module_name name) :
         scheduler = new SchedulerFrFcfs();
     else if (config.scheduler == "FrFcfsGrp")
         scheduler = new SchedulerFrFcfsGrp();
+    else if (config.scheduler == "WriteDrain")
+        scheduler = new SchedulerWriteDrain();
+    else if (config.scheduler == "Bliss")
+        scheduler = new SchedulerBliss(currentCycle);
     else
         SC_REPORT_FATAL("Controller", "Selected scheduler not supported!");
 
+    if (config.requestBufferPolicy == "Bankwise")
+        bufferCounter = new BufferCounterBankwise();
+    else if (config.requestBufferPolicy == "Shared")
+        bufferCounter = new BufferCounterShared();
+    else
+        SC_REPORT_FATAL("Controller", "Selected request buffer policy not supported!");
+
     if (config.cmdMux == "Oldest")
         cmdMux = new CmdMuxOldest();
     else if (config.cmdMux == "Strict")
@@ -117,26 +167,31 @@ Controller::Controller(sc_module_name name) :
     else
         SC_REPORT_FATAL("Controller", "Selected respqueue not supported!");
 
+    // the bank machines of each rank query the checker through one batch per rank
+    for (unsigned rankID = 0; rankID < memSpec->numberOfRanks; rankID++)
+        rankTimingBatches.push_back(new RankTimingBatch(checker, Rank(rankID), currentCycle));
+    auto timingBatch = [&](unsigned bankID) { return rankTimingBatches[bankID / memSpec->banksPerRank]; };
+
     // instantiate bank machines (one per bank)
     if (config.pagePolicy == "Open")
     {
         for (unsigned bankID = 0; bankID < memSpec->numberOfBanks; bankID++)
-            bankMachines.push_back(new BankMachineOpen(scheduler, checker, Bank(bankID)));
+            bankMachines.push_back(new BankMachineOpen(scheduler, timingBatch(bankID), Bank(bankID)));
     }
     else if (config.pagePolicy == "OpenAdaptive")
     {
         for (unsigned bankID = 0; bankID < memSpec->numberOfBanks; bankID++)
-            bankMachines.push_back(new BankMachineOpenAdaptive(scheduler, checker, Bank(bankID)));
+            bankMachines.push_back(new BankMachineOpenAdaptive(scheduler, timingBatch(bankID), Bank(bankID)));
     }
     else if (config.pagePolicy == "Closed")
     {
         for (unsigned bankID = 0; bankID < memSpec->numberOfBanks; bankID++)
-            bankMachines.push_back(new BankMachineClosed(scheduler, checker, Bank(bankID)));
+            bankMachines.push_back(new BankMachineClosed(scheduler, timingBatch(bankID), Bank(bankID)));
     }
     else if (config.pagePolicy == "ClosedAdaptive")
     {
         for (unsigned bankID = 0; bankID < memSpec->numberOfBanks; bankID++)
-            bankMachines.push_back(new BankMachineClosedAdaptive(scheduler, checker, Bank(bankID)));
+            bankMachines.push_back(new BankMachineClosedAdaptive(scheduler, timingBatch(bankID), Bank(bankID)));
     }
     else
         SC_REPORT_FATAL("Controller", "Selected page policy not supported!");
@@ -147,6 +202,20 @@ Controller::Controller(sc_module_name name) :
                 bankMachines.begin() + (rankID + 1) * memSpec->banksPerRank));
     }
 
+    if (config.controllerMode == "Polling")
+        eventDriven = false;
+    else if (config.controllerMode == "EventDriven")
+        eventDriven = true;
+    else
+        SC_REPORT_FATAL("Controller", "Selected controller mode not supported!");
+
+    bankMachineIsActive = std::vector<bool>(memSpec->numberOfBanks, false);
+    activeBankMachinesOnRank = std::vector<std::vector<BankMachine *>>(memSpec->numberOfRanks);
+
+    readyCommands = std::vector<CommandCandidate>(memSpec->numberOfBanks + memSpec->numberOfRanks);
+
+    requestCredits = config.requestCredits;
+
     // instantiate power-down managers (one per rank)
     if (config.powerDownPolicy == "NoPowerDown")
     {
@@ -178,7 +247,7 @@ Controller::Controller(sc_module_name name) :
         for (unsigned rankID = 0; rankID < memSpec->numberOfRanks; rankID++)
         {
             RefreshManagerIF *manager = new RefreshManagerRankwise
-                    (bankMachinesOnRank[rankID], powerDownManagers[rankID], Rank(rankID), checker);
+                    (bankMachinesOnRank[rankID], powerDownManagers[rankID], Rank(rankID), checker, currentCycle);
             refreshManagers.push_back(manager);
         }
     }
@@ -188,7 +257,7 @@ Controller::Controller(sc_module_name name) :
         {
             // TODO: remove bankMachines in constructor
             RefreshManagerIF *manager = new RefreshManagerBankwise
-                    (bankMachinesOnRank[rankID], powerDownManagers[rankID], Rank(rankID), checker);
+                    (bankMachinesOnRank[rankID], powerDownManagers[rankID], Rank(rankID), checker, currentCycle);
             refreshManagers.push_back(manager);
         }
     }
@@ -202,20 +271,29 @@ Controller::~Controller()
 {
     idleTimeCollector.end();
 
+    checker->printStatistics(name());
+    scheduler->printStatistics(name());
+
     for (auto it : refreshManagers)
         delete it;
     for (auto it : powerDownManagers)
         delete it;
     for (auto it : bankMachines)
         delete it;
+    for (auto it : rankTimingBatches)
+        delete it;
     delete respQueue;
     delete cmdMux;
+    delete bufferCounter;
     delete scheduler;
     delete checker;
 }
 
 void Controller::controllerMethod()
 {
+    // All internal timing is done in clock cycles, sc_time is only used towards TLM and SystemC events
+    currentCycle = memSpec->getCurrentCycle();
+
     // (1) Release payload if arbiter has accepted the result (finish END_RESP)
     if (payloadToRelease != nullptr && timeToRelease <= sc_time_stamp())
         finishEndResp();
@@ -225,10 +303,13 @@ void Controller::controllerMethod()
         startBeginResp();
 
     // (3) Insert new request from arbiter into scheduler and restart appropriate BM (finish BEGIN_REQ)
-    if (payloadToAcquire != nullptr && timeToAcquire <= sc_time_stamp())
+    if (requestCredits > 0)
+        acquireCreditedPayloads();
+    else if (payloadToAcquire != nullptr && timeToAcquire <= sc_time_stamp())
     {
         unsigned bankID = DramExtension::getBank(payloadToAcquire).ID();
         finishBeginReq();
+        activateBankMachine(bankMachines[bankID]);
         bankMachines[bankID]->start();
     }
 
@@ -239,57 +320,73 @@ void Controller::controllerMethod()
         it->start();
 
     // (5) Choose one request and send it to DRAM
-    std::tuple<Command, tlm_generic_payload *, sc_time> commandTuple;
-    std::list<std::tuple<Command, tlm_generic_payload *, sc_time>> readyCommands;
+    CommandCandidate commandCandidate;
+    numberOfReadyCommands = 0;
+    commandsPending = false;
     for (unsigned rankID = 0; rankID < memSpec->numberOfRanks; rankID++)
     {
         // (5.1) Check for power-down commands (PDEA/PDEP/SREFEN or PDXA/PDXP/SREFEX)
-        commandTuple = powerDownManagers[rankID]->getNextCommand();
-        if (std::get<0>(commandTuple) != Command::NOP)
-            readyCommands.push_back(commandTuple);
+        commandCandidate = powerDownManagers[rankID]->getNextCommand();
+        if (commandCandidate.command != Command::NOP)
+            addReadyCommand(commandCandidate);
         else
         {
             // (5.2) Check for refresh commands (PREA/PRE or REFA/REFB)
-            commandTuple = refreshManagers[rankID]->getNextCommand();
-            if (std::get<0>(commandTuple) != Command::NOP)
-                readyCommands.push_back(commandTuple);
+            commandCandidate = refreshManagers[rankID]->getNextCommand();
+            if (commandCandidate.command != Command::NOP)
+                addReadyCommand(commandCandidate);
 
             // (5.3) Check for bank commands (PRE, ACT, RD/RDA or WR/WRA)
-            for (auto it : bankMachinesOnRank[rankID])
+            // In event-driven mode all other bank machines have no command ready
+            std::vector<BankMachine *> &candidates = eventDriven ?
+                    activeBankMachinesOnRank[rankID] : bankMachinesOnRank[rankID];
+            for (auto it : candidates)
             {
-                commandTuple = it->getNextCommand();
-                if (std::get<0>(commandTuple) != Command::NOP)
-                    readyCommands.push_back(commandTuple);
+                commandCandidate = it->getNextCommand();
+                if (commandCandidate.command != Command::NOP)
+                    addReadyCommand(commandCandidate);
             }
         }
     }
 
     bool readyCmdBlocked = false;
-    if (!readyCommands.empty())
+    if (commandsPending)
     {
-        commandTuple = cmdMux->selectCommand(readyCommands);
-        if (std::get<0>(commandTuple) != Command::NOP) // can happen with FIFO strict
+        commandCandidate = cmdMux->selectCommand(readyCommands.data(), numberOfReadyCommands);
+        if (commandCandidate.command != Command::NOP) // can happen with FIFO strict
         {
-            Rank rank = DramExtension::getRank(std::get<1>(commandTuple));
-            BankGroup bankgroup = DramExtension::getBankGroup(std::get<1>(commandTuple));
-            Bank bank = DramExtension::getBank(std::get<1>(commandTuple));
+            Command command = commandCandidate.command;
+            tlm_generic_payload *payload = commandCandidate.payload;
+
+            Rank rank = DramExtension::getRank(payload);
+            BankGroup bankgroup = DramExtension::getBankGroup(payload);
+            Bank bank = DramExtension::getBank(payload);
 
-            if (isRankCommand(std::get<0>(commandTuple)))
+            if (isRankCommand(command))
             {
                 for (auto it : bankMachinesOnRank[rank.ID()])
-                    it->updateState(std::get<0>(commandTuple));
+                {
+                    it->updateState(command);
+                    activateBankMachine(it);
+                }
             }
             else
-                bankMachines[bank.ID()]->updateState(std::get<0>(commandTuple));
+            {
+                bankMachines[bank.ID()]->updateState(command);
+                activateBankMachine(bankMachines[bank.ID()]);
+            }
 
-            refreshManagers[rank.ID()]->updateState(std::get<0>(commandTuple));
-            powerDownManagers[rank.ID()]->updateState(std::get<0>(commandTuple));
-            checker->insert(std::get<0>(commandTuple), rank, bankgroup, bank);
+            refreshManagers[rank.ID()]->updateState(command);
+            powerDownManagers[rank.ID()]->updateState(command);
+            checker->insert(command, rank, bankgroup, bank);
+            for (auto it : rankTimingBatches)
+                it->invalidate();
 
-            if (isCasCommand(std::get<0>(commandTuple)))
+            if (isCasCommand(command))
             {
-                scheduler->removeRequest(std::get<1>(commandTuple));
-                respQueue->insertPayload(std::get<1>(commandTuple), memSpec->getIntervalOnDataStrobe(std::get<0>(commandTuple)).end);
+                scheduler->removeRequest(payload);
+                bufferCounter->removeRequest(payload);
+                respQueue->insertPayload(payload, memSpec->getIntervalOnDataStrobe(command).end);
 
                 sc_time triggerTime = respQueue->getTriggerTime();
                 if (triggerTime != sc_max_time())
@@ -300,32 +397,122 @@ void Controller::controllerMethod()
             if (ranksNumberOfPayloads[rank.ID()] == 0)
                 powerDownManagers[rank.ID()]->triggerEntry();
 
-            sendToDram(std::get<0>(commandTuple), std::get<1>(commandTuple));
+            sendToDram(command, payload);
         }
         else
             readyCmdBlocked = true;
     }
 
     // (6) Accept request from arbiter if scheduler is not full, otherwise backpressure (start END_REQ)
-    if (payloadToAcquire != nullptr && timeToAcquire == sc_max_time())
+    if (requestCredits > 0)
+        acquireCreditedPayloads();
+    else if (payloadToAcquire != nullptr && timeToAcquire == sc_max_time())
         startEndReq();
 
     // (7) Restart bank machines, refresh managers and power-down managers to issue new requests for the future
-    // TODO: check if all calls are necessary
-    sc_time timeForNextTrigger = sc_max_time();
-    for (auto it : bankMachines)
+    uint64_t timeForNextTrigger = MAX_CYCLE;
+    if (eventDriven)
+    {
+        if (scheduler->hasPriorityChanged())
+        {
+            for (auto it : bankMachines)
+                activateBankMachine(it);
+        }
+
+        // Idle bank machines (no request, sleeping or blocked) keep returning NOP until a new
+        // request arrives or their state is updated, so only active bank machines are restarted
+        for (auto &activeBankMachines : activeBankMachinesOnRank)
+        {
+            auto it = activeBankMachines.begin();
+            while (it != activeBankMachines.end())
+            {
+                uint64_t localTime = (*it)->start();
+                if (!(localTime == currentCycle && readyCmdBlocked))
+                    timeForNextTrigger = std::min(timeForNextTrigger, localTime);
+
+                if (localTime == MAX_CYCLE)
+                {
+                    bankMachineIsActive[(*it)->getBank().ID()] = false;
+                    it = activeBankMachines.erase(it);
+                }
+                else
+                    it++;
+            }
+        }
+    }
+    else
     {
-        sc_time localTime = it->start();
-        if (!(localTime == sc_time_stamp() && readyCmdBlocked))
-            timeForNextTrigger = std::min(timeForNextTrigger, localTime);
+        for (auto it : bankMachines)
+        {
+            uint64_t localTime = it->start();
+            if (!(localTime == currentCycle && readyCmdBlocked))
+                timeForNextTrigger = std::min(timeForNextTrigger, localTime);
+        }
     }
     for (auto it : refreshManagers)
         timeForNextTrigger = std::min(timeForNextTrigger, it->start());
     for (auto it : powerDownManagers)
         timeForNextTrigger = std::min(timeForNextTrigger, it->start());
 
-    if (timeForNextTrigger != sc_max_time())
-        controllerEvent.notify(timeForNextTrigger - sc_time_stamp());
+    if (timeForNextTrigger != MAX_CYCLE)
+    {
+        // If the controller was woken between two clock edges, the current cycle is rounded and a trigger
+        // in this cycle can lie before the current time, it is then due immediately
+        sc_time triggerTime = memSpec->cyclesToTime(timeForNextTrigger);
+        controllerEvent.notify(triggerTime > sc_time_stamp() ? triggerTime - sc_time_stamp() : SC_ZERO_TIME);
+    }
+}
+
+void Controller::activateBankMachine(BankMachine *bankMachine)
+{
+    if (!eventDriven)
+        return;
+
+    unsigned bankID = bankMachine->getBank().ID();
+    if (!bankMachineIsActive[bankID])
+    {
+        // Keep the active bank machines sorted by bank ID to preserve the command order of the polling mode
+        std::vector<BankMachine *> &activeBankMachines = activeBankMachinesOnRank[bankMachine->getRank().ID()];
+        auto it = std::lower_bound(activeBankMachines.begin(), activeBankMachines.end(), bankID,
+                [](BankMachine *element, unsigned id){return element->getBank().ID() < id;});
+        activeBankMachines.insert(it, bankMachine);
+        bankMachineIsActive[bankID] = true;
+    }
+}
+
+void Controller::acquireCreditedPayloads()
+{
+    // Credited requests have already finished END_REQ, they enter the scheduler as long as it has buffer space
+    while (!creditedPayloads.empty() && creditedPayloads.front().second <= sc_time_stamp()
+           && bufferCounter->hasBufferSpace(*creditedPayloads.front().first))
+    {
+        payloadToAcquire = creditedPayloads.front().first;
+        creditedPayloads.pop();
+
+        unsigned bankID = DramExtension::getBank(payloadToAcquire).ID();
+        finishBeginReq();
+        activateBankMachine(bankMachines[bankID]);
+        bankMachines[bankID]->start();
+    }
+    payloadToAcquire = nullptr;
+
+    // Return a credit to the request that was stalled because all credits were in use (start END_REQ)
+    if (payloadWaitingForCredit != nullptr && creditedPayloads.size() < requestCredits)
+    {
+        creditedPayloads.push({payloadWaitingForCredit, sc_time_stamp() + memSpec->tCK});
+        beginReqEvent.notify(memSpec->tCK);
+        payloadWaitingForCredit->set_response_status(TLM_OK_RESPONSE);
+        sendToFrontend(payloadWaitingForCredit, END_REQ);
+        payloadWaitingForCredit = nullptr;
+    }
+}
+
+void Controller::addReadyCommand(const CommandCandidate &commandCandidate)
+{
+    // Commands scheduled for a later time are not passed to the command multiplexer
+    commandsPending = true;
+    if (commandCandidate.timeToSchedule == currentCycle)
+        readyCommands[numberOfReadyCommands++] = commandCandidate;
 }
 
 tlm_sync_enum Controller::nb_transport_fw(tlm_generic_payload &trans,
@@ -333,7 +520,24 @@ tlm_sync_enum Controller::nb_transport_fw(tlm_generic_payload &trans,
 {
     sc_time notificationDelay = delay + Configuration::getInstance().memSpec->tCK;
 
-    if (phase == BEGIN_REQ)
+    if (phase == BEGIN_REQ && requestCredits > 0)
+    {
+        if (creditedPayloads.size() < requestCredits)
+        {
+            // Early completion: the request takes a credit and finishes END_REQ immediately
+            creditedPayloads.push({&trans, sc_time_stamp() + notificationDelay});
+            beginReqEvent.notify(notificationDelay);
+            PRINTDEBUGMESSAGE(name(), "[fw] " + getPhaseName(phase) + " completed early");
+
+            trans.set_response_status(TLM_OK_RESPONSE);
+            phase = END_REQ;
+            delay = SC_ZERO_TIME;
+            return TLM_UPDATED;
+        }
+        else
+            payloadWaitingForCredit = &trans;
+    }
+    else if (phase == BEGIN_REQ)
     {
         payloadToAcquire = &trans;
         timeToAcquire = sc_time_stamp() + notificationDelay;
@@ -374,6 +578,23 @@ void Controller::finishBeginReq()
         idleTimeCollector.end();
     totalNumberOfPayloads++;
 
+    tlm_generic_payload *forwardingWrite = scheduler->getForwardingWrite(payloadToAcquire);
+    if (forwardingWrite != nullptr)
+    {
+        // Read data is taken from the pending write, no DRAM access required
+        if (payloadToAcquire->get_data_ptr() != nullptr && forwardingWrite->get_data_ptr() != nullptr)
+            std::memcpy(payloadToAcquire->get_data_ptr(), forwardingWrite->get_data_ptr(),
+                        payloadToAcquire->get_data_length());
+        payloadToAcquire->acquire();
+        timeToAcquire = sc_max_time();
+
+        respQueue->insertPayload(payloadToAcquire, sc_time_stamp() + memSpec->tCK);
+        sc_time triggerTime = respQueue->getTriggerTime();
+        if (triggerTime != sc_max_time())
+            dataResponseEvent.notify(triggerTime - sc_time_stamp());
+        return;
+    }
+
     Rank rank = DramExtension::getRank(payloadToAcquire);
     if (ranksNumberOfPayloads[rank.ID()] == 0)
         powerDownManagers[rank.ID()]->triggerExit();
@@ -381,13 +602,15 @@ void Controller::finishBeginReq()
     ranksNumberOfPayloads[rank.ID()]++;
 
     scheduler->storeRequest(payloadToAcquire);
+    bufferCounter->storeRequest(payloadToAcquire);
     payloadToAcquire->acquire();
     timeToAcquire = sc_max_time();
 }
 
 void Controller::startEndReq()
 {
-    if (scheduler->hasBufferSpace())
+    // The request is already stored, END_REQ is held back while its bank, rank or type is full
+    if (bufferCounter->hasBufferSpace(*payloadToAcquire))
     {
         payloadToAcquire->set_response_status(TLM_OK_RESPONSE);
         sendToFrontend(payloadToAcquire, END_REQ);
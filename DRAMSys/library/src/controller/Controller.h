@@ -47,8 +47,10 @@
 #include "BankMachine.h"
 #include "cmdmux/CmdMuxIF.h"
 #include "scheduler/SchedulerIF.h"
+#include "scheduler/BufferCounterIF.h"
 #include "../common/DebugManager.h"
 #include "checker/CheckerIF.h"
+#include "checker/RankTimingBatch.h"
 #include "refresh/RefreshManagerIF.h"
 #include "powerdown/PowerDownManagerIF.h"
 #include "respqueue/RespQueueIF.h"
@@ -77,12 +79,28 @@ private:
     std::vector<unsigned> ranksNumberOfPayloads;
 
     MemSpec *memSpec;
+    uint64_t currentCycle = 0;
 
     std::vector<BankMachine *> bankMachines;
     std::vector<std::vector<BankMachine *>> bankMachinesOnRank;
+
+    // Event-driven mode: only bank machines with a pending command or changed inputs are restarted
+    bool eventDriven = false;
+    std::vector<bool> bankMachineIsActive;
+    std::vector<std::vector<BankMachine *>> activeBankMachinesOnRank;
+    void activateBankMachine(BankMachine *);
+
+    // Preallocated candidate array (at most one command per bank machine and one per rank)
+    std::vector<CommandCandidate> readyCommands;
+    unsigned numberOfReadyCommands = 0;
+    bool commandsPending = false;
+    void addReadyCommand(const CommandCandidate &);
+
     CmdMuxIF *cmdMux;
     SchedulerIF *scheduler;
+    BufferCounterIF *bufferCounter;
     CheckerIF *checker;
+    std::vector<RankTimingBatch *> rankTimingBatches;
     RespQueueIF *respQueue;
     std::vector<RefreshManagerIF *> refreshManagers;
     std::vector<PowerDownManagerIF *> powerDownManagers;
@@ -92,6 +110,12 @@ private:
     tlm::tlm_generic_payload *payloadToRelease = nullptr;
     sc_time timeToRelease = sc_max_time();
 
+    // Credit-based flow control: up to requestCredits requests finish END_REQ before they enter the scheduler
+    unsigned requestCredits = 0;
+    std::queue<std::pair<tlm::tlm_generic_payload *, sc_time>> creditedPayloads;
+    tlm::tlm_generic_payload *payloadWaitingForCredit = nullptr;
+    void acquireCreditedPayloads();
+
     void finishBeginReq();
     void startEndReq();
     void startBeginResp();
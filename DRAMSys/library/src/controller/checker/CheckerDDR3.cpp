@@ -34,379 +34,404 @@
 
 #include "CheckerDDR3.h"
 
-CheckerDDR3::CheckerDDR3()
+CheckerDDR3::CheckerDDR3(const uint64_t &currentCycle) : CheckerIF(currentCycle)
 {
     Configuration &config = Configuration::getInstance();
     memSpec = dynamic_cast<MemSpecDDR3 *>(config.memSpec);
     if (memSpec == nullptr)
         SC_REPORT_FATAL("CheckerDDR3", "Wrong MemSpec chosen");
 
-    lastScheduledByCommandAndBank = std::vector<std::vector<sc_time>>
-            (numberOfCommands(), std::vector<sc_time>(memSpec->numberOfBanks));
-    lastScheduledByCommandAndRank = std::vector<std::vector<sc_time>>
-            (numberOfCommands(), std::vector<sc_time>(memSpec->numberOfRanks));
-    lastScheduledByCommand = std::vector<sc_time>(numberOfCommands());
-
-    last4Activates = std::vector<std::queue<sc_time>>(memSpec->numberOfRanks);
-
-    tBURST = memSpec->burstLength / memSpec->dataRate * memSpec->tCK;
-    tRDWR = memSpec->tRL + tBURST + 2 * memSpec->tCK - memSpec->tWL;
-    tRDWR_R = memSpec->tRL + tBURST + memSpec->tRTRS - memSpec->tWL;
-    tWRRD = memSpec->tWL + tBURST + memSpec->tWTR;
-    tWRRD_R = memSpec->tWL + tBURST + memSpec->tRTRS - memSpec->tRL;
-    tWRPRE = memSpec->tWL + tBURST + memSpec->tWR;
-    tRDPDEN = memSpec->tRL + tBURST + memSpec->tCK;
-    tWRPDEN = memSpec->tWL + tBURST + memSpec->tWR;
-    tWRAPDEN = memSpec->tWL + tBURST + memSpec->tWR + memSpec->tCK;
+    lastScheduledByCommandAndBank = std::vector<std::vector<uint64_t>>
+            (numberOfCommands(), std::vector<uint64_t>(memSpec->numberOfBanks));
+    lastScheduledByCommandAndRank = std::vector<std::vector<uint64_t>>
+            (numberOfCommands(), std::vector<uint64_t>(memSpec->numberOfRanks));
+    lastScheduledByCommand = std::vector<uint64_t>(numberOfCommands());
+
+    last4Activates = std::vector<std::queue<uint64_t>>(memSpec->numberOfRanks);
+
+    tRL = memSpec->timeToCycles(memSpec->tRL);
+    tWL = memSpec->timeToCycles(memSpec->tWL);
+    tRTRS = memSpec->timeToCycles(memSpec->tRTRS);
+    tWTR = memSpec->timeToCycles(memSpec->tWTR);
+    tWR = memSpec->timeToCycles(memSpec->tWR);
+    tRCD = memSpec->timeToCycles(memSpec->tRCD);
+    tRC = memSpec->timeToCycles(memSpec->tRC);
+    tAL = memSpec->timeToCycles(memSpec->tAL);
+    tCCD = memSpec->timeToCycles(memSpec->tCCD);
+    tRTP = memSpec->timeToCycles(memSpec->tRTP);
+    tXP = memSpec->timeToCycles(memSpec->tXP);
+    tXSDLL = memSpec->timeToCycles(memSpec->tXSDLL);
+    tXS = memSpec->timeToCycles(memSpec->tXS);
+    tRRD = memSpec->timeToCycles(memSpec->tRRD);
+    tRP = memSpec->timeToCycles(memSpec->tRP);
+    tRFC = memSpec->timeToCycles(memSpec->tRFC);
+    tFAW = memSpec->timeToCycles(memSpec->tFAW);
+    tRAS = memSpec->timeToCycles(memSpec->tRAS);
+    tACTPDEN = memSpec->timeToCycles(memSpec->tACTPDEN);
+    tPRPDEN = memSpec->timeToCycles(memSpec->tPRPDEN);
+    tCKE = memSpec->timeToCycles(memSpec->tCKE);
+    tPD = memSpec->timeToCycles(memSpec->tPD);
+    tREFPDEN = memSpec->timeToCycles(memSpec->tREFPDEN);
+    tCKESR = memSpec->timeToCycles(memSpec->tCKESR);
+
+    tBURST = memSpec->burstLength / memSpec->dataRate;
+    tRDWR = tRL + tBURST + 2 - tWL;
+    tRDWR_R = tRL + tBURST + tRTRS - tWL;
+    tWRRD = tWL + tBURST + tWTR;
+    tWRRD_R = tWL + tBURST + tRTRS - tRL;
+    tWRPRE = tWL + tBURST + tWR;
+    tRDPDEN = tRL + tBURST + 1;
+    tWRPDEN = tWL + tBURST + tWR;
+    tWRAPDEN = tWL + tBURST + tWR + 1;
 }
 
-sc_time CheckerDDR3::timeToSatisfyConstraints(Command command, Rank rank, BankGroup, Bank bank) const
+uint64_t CheckerDDR3::timeToSatisfyConstraints(Command command, Rank rank, BankGroup, Bank bank) const
 {
-    sc_time lastCommandStart;
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t lastCommandStart;
+    uint64_t earliestTimeToStart = currentCycle;
 
     if (command == Command::RD || command == Command::RDA)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRCD - memSpec->tAL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRCD - tAL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCD);
 
-        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCD);
 
-        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         if (command == Command::RDA)
         {
             lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
-            if (lastCommandStart != SC_ZERO_TIME)
-                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE - memSpec->tRTP);
+            if (lastCommandStart != 0)
+                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE - tRTP);
         }
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD);
 
         lastCommandStart = lastScheduledByCommand[Command::WR];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD);
 
         lastCommandStart = lastScheduledByCommand[Command::WRA];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXSDLL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXSDLL);
     }
     else if (command == Command::WR || command == Command::WRA)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRCD - memSpec->tAL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRCD - tAL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
 
-        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
+        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : 0;
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR);
 
-        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
+        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : 0;
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCD);
 
-        lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCD);
 
-        lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXSDLL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXSDLL);
     }
     else if (command == Command::ACT)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRRD);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tAL + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PRE][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
 
         if (last4Activates[rank.ID()].size() >= 4)
-            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + memSpec->tFAW);
+            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + tFAW);
     }
     else if (command == Command::PRE)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRAS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RD][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tAL + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
     }
     else if (command == Command::PREA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRAS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tAL + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tAL + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
     }
     else if (command == Command::REFA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tAL + memSpec->tRTP + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tAL + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
     }
     else if (command == Command::PDEA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tACTPDEN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tACTPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPRPDEN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKE);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCKE);
     }
     else if (command == Command::PDXA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPD);
     }
     else if (command == Command::PDEP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRAPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPRPDEN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPRPDEN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPRPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKE);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCKE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tREFPDEN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tREFPDEN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
     }
     else if (command == Command::PDXP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPD);
     }
     else if (command == Command::SREFEN)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tRDPDEN, memSpec->tAL + memSpec->tRTP + memSpec->tRP));
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tRDPDEN, tAL + tRTP + tRP));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + memSpec->tRP));
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tWRAPDEN, tWRPRE + tRP));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
     }
     else if (command == Command::SREFEX)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEN][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKESR);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCKESR);
     }
     else
         SC_REPORT_FATAL("CheckerDDR3", "Unknown command!");
 
-    earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec->tCK);
+    earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + 1);
 
     return earliestTimeToStart;
 }
@@ -416,16 +441,16 @@ void CheckerDDR3::insert(Command command, Rank rank, BankGroup, Bank bank)
     PRINTDEBUGMESSAGE("CheckerDDR3", "Changing state on bank " + std::to_string(bank.ID())
                       + " command is " + commandToString(command));
 
-    lastScheduledByCommandAndRank[command][rank.ID()] = sc_time_stamp();
-    lastScheduledByCommandAndBank[command][bank.ID()] = sc_time_stamp();
-    lastScheduledByCommand[command] = sc_time_stamp();
+    lastScheduledByCommandAndRank[command][rank.ID()] = currentCycle;
+    lastScheduledByCommandAndBank[command][bank.ID()] = currentCycle;
+    lastScheduledByCommand[command] = currentCycle;
 
-    lastCommandOnBus = sc_time_stamp();
+    lastCommandOnBus = currentCycle;
 
     if (command == Command::ACT)
     {
         if (last4Activates[rank.ID()].size() == 4)
             last4Activates[rank.ID()].pop();
-        last4Activates[rank.ID()].push(sc_time_stamp());
+        last4Activates[rank.ID()].push(currentCycle);
     }
 }
@@ -44,30 +44,56 @@
 class CheckerDDR3 final : public CheckerIF
 {
 public:
-    CheckerDDR3();
-    virtual sc_time timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
+    CheckerDDR3(const uint64_t &currentCycle);
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
     virtual void insert(Command, Rank, BankGroup, Bank) override;
 
 private:
     const MemSpecDDR3 *memSpec;
 
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndBank;
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndRank;
-    std::vector<sc_time> lastScheduledByCommand;
-    sc_time lastCommandOnBus;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndBank;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndRank;
+    std::vector<uint64_t> lastScheduledByCommand;
+    uint64_t lastCommandOnBus = 0;
 
     // Four activate window
-    std::vector<std::queue<sc_time>> last4Activates;
+    std::vector<std::queue<uint64_t>> last4Activates;
 
-    sc_time tBURST;
-    sc_time tRDWR;
-    sc_time tRDWR_R;
-    sc_time tWRRD;
-    sc_time tWRPRE;
-    sc_time tWRRD_R;
-    sc_time tRDPDEN;
-    sc_time tWRPDEN;
-    sc_time tWRAPDEN;
+    // Timing constraints in clock cycles
+    uint64_t tRL;
+    uint64_t tWL;
+    uint64_t tRTRS;
+    uint64_t tWTR;
+    uint64_t tWR;
+    uint64_t tRCD;
+    uint64_t tRC;
+    uint64_t tAL;
+    uint64_t tCCD;
+    uint64_t tRTP;
+    uint64_t tXP;
+    uint64_t tXSDLL;
+    uint64_t tXS;
+    uint64_t tRRD;
+    uint64_t tRP;
+    uint64_t tRFC;
+    uint64_t tFAW;
+    uint64_t tRAS;
+    uint64_t tACTPDEN;
+    uint64_t tPRPDEN;
+    uint64_t tCKE;
+    uint64_t tPD;
+    uint64_t tREFPDEN;
+    uint64_t tCKESR;
+
+    uint64_t tBURST;
+    uint64_t tRDWR;
+    uint64_t tRDWR_R;
+    uint64_t tWRRD;
+    uint64_t tWRPRE;
+    uint64_t tWRRD_R;
+    uint64_t tRDPDEN;
+    uint64_t tWRPDEN;
+    uint64_t tWRAPDEN;
 };
 
 #endif // CHECKERDDR3_H
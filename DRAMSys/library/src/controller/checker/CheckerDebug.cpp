@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "CheckerDebug.h"
+#include "../../configuration/Configuration.h"
+
+CheckerDebug::CheckerDebug(const uint64_t &currentCycle, CheckerIF *standardChecker, CheckerIF *tableChecker)
+    : CheckerIF(currentCycle), standardChecker(standardChecker), tableChecker(tableChecker)
+{
+    standardTimes = std::vector<uint64_t>(Configuration::getInstance().memSpec->banksPerRank);
+}
+
+CheckerDebug::~CheckerDebug()
+{
+    delete standardChecker;
+    delete tableChecker;
+}
+
+uint64_t CheckerDebug::timeToSatisfyConstraints(Command command, Rank rank, BankGroup bankgroup, Bank bank) const
+{
+    uint64_t standardTime = standardChecker->timeToSatisfyConstraints(command, rank, bankgroup, bank);
+    uint64_t tableTime = tableChecker->timeToSatisfyConstraints(command, rank, bankgroup, bank);
+    if (standardTime != tableTime)
+        reportMismatch(command, rank, bank, standardTime, tableTime);
+    return tableTime;
+}
+
+void CheckerDebug::insert(Command command, Rank rank, BankGroup bankgroup, Bank bank)
+{
+    standardChecker->insert(command, rank, bankgroup, bank);
+    tableChecker->insert(command, rank, bankgroup, bank);
+}
+
+void CheckerDebug::timeToSatisfyConstraintsOnRank(Command command, Rank rank, uint64_t *earliestTimes) const
+{
+    unsigned banksPerRank = standardTimes.size();
+
+    standardChecker->timeToSatisfyConstraintsOnRank(command, rank, standardTimes.data());
+    tableChecker->timeToSatisfyConstraintsOnRank(command, rank, earliestTimes);
+    for (unsigned bankID = 0; bankID < banksPerRank; bankID++)
+    {
+        if (standardTimes[bankID] != earliestTimes[bankID])
+            reportMismatch(command, rank, Bank(rank.ID() * banksPerRank + bankID),
+                           standardTimes[bankID], earliestTimes[bankID]);
+    }
+}
+
+bool CheckerDebug::evaluatesRankNatively() const
+{
+    // Only a performance hint, the rank evaluation compares both checkers for all banks of the rank
+    return tableChecker->evaluatesRankNatively();
+}
+
+void CheckerDebug::printStatistics(const std::string &name) const
+{
+    standardChecker->printStatistics(name);
+    tableChecker->printStatistics(name);
+}
+
+void CheckerDebug::reportMismatch(Command command, Rank rank, Bank bank,
+                                  uint64_t standardTime, uint64_t tableTime) const
+{
+    SC_REPORT_FATAL("CheckerDebug", ("Checkers disagree on " + commandToString(command)
+                    + " (rank " + std::to_string(rank.ID()) + ", bank " + std::to_string(bank.ID())
+                    + "): hand-written checker " + std::to_string(standardTime)
+                    + ", table-driven checker " + std::to_string(tableTime)).c_str());
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef CHECKERDEBUG_H
+#define CHECKERDEBUG_H
+
+#include <vector>
+#include "CheckerIF.h"
+
+// Runs the hand-written checker of a standard and its table-driven checker side by side
+// and stops the simulation as soon as their results differ
+class CheckerDebug final : public CheckerIF
+{
+public:
+    CheckerDebug(const uint64_t &currentCycle, CheckerIF *standardChecker, CheckerIF *tableChecker);
+    virtual ~CheckerDebug();
+
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
+    virtual void insert(Command, Rank, BankGroup, Bank) override;
+    virtual void timeToSatisfyConstraintsOnRank(Command, Rank, uint64_t *earliestTimes) const override;
+    virtual bool evaluatesRankNatively() const override;
+    virtual void printStatistics(const std::string &) const override;
+
+private:
+    void reportMismatch(Command, Rank, Bank, uint64_t standardTime, uint64_t tableTime) const;
+
+    CheckerIF *standardChecker;
+    CheckerIF *tableChecker;
+    mutable std::vector<uint64_t> standardTimes;
+};
+
+#endif // CHECKERDEBUG_H
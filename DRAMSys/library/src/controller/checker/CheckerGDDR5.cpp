@@ -34,492 +34,525 @@
 
 #include "CheckerGDDR5.h"
 
-CheckerGDDR5::CheckerGDDR5()
+CheckerGDDR5::CheckerGDDR5(const uint64_t &currentCycle) : CheckerIF(currentCycle)
 {
     Configuration &config = Configuration::getInstance();
     memSpec = dynamic_cast<MemSpecGDDR5 *>(config.memSpec);
     if (memSpec == nullptr)
         SC_REPORT_FATAL("CheckerGDDR5", "Wrong MemSpec chosen");
 
-    lastScheduledByCommandAndBank = std::vector<std::vector<sc_time>>
-            (numberOfCommands(), std::vector<sc_time>(memSpec->numberOfBanks));
-    lastScheduledByCommandAndBankGroup = std::vector<std::vector<sc_time>>
-            (numberOfCommands(), std::vector<sc_time>(memSpec->numberOfBankGroups));
-    lastScheduledByCommandAndRank = std::vector<std::vector<sc_time>>
-            (numberOfCommands(), std::vector<sc_time>(memSpec->numberOfRanks));
-    lastScheduledByCommand = std::vector<sc_time>(numberOfCommands());
+    lastScheduledByCommandAndBank = std::vector<std::vector<uint64_t>>
+            (numberOfCommands(), std::vector<uint64_t>(memSpec->numberOfBanks));
+    lastScheduledByCommandAndBankGroup = std::vector<std::vector<uint64_t>>
+            (numberOfCommands(), std::vector<uint64_t>(memSpec->numberOfBankGroups));
+    lastScheduledByCommandAndRank = std::vector<std::vector<uint64_t>>
+            (numberOfCommands(), std::vector<uint64_t>(memSpec->numberOfRanks));
+    lastScheduledByCommand = std::vector<uint64_t>(numberOfCommands());
 
-    last4Activates = std::vector<std::queue<sc_time>>(memSpec->numberOfRanks);
-    last32Activates = std::vector<std::queue<sc_time>>(memSpec->numberOfRanks);
+    last4Activates = std::vector<std::queue<uint64_t>>(memSpec->numberOfRanks);
+    last32Activates = std::vector<std::queue<uint64_t>>(memSpec->numberOfRanks);
 
     bankwiseRefreshCounter = std::vector<unsigned>(memSpec->numberOfRanks);
 
-    tBURST = memSpec->burstLength / memSpec->dataRate * memSpec->tCK;
-    tRDSRE = memSpec->tCL + memSpec->tWCK2CKPIN + memSpec->tWCK2CK + memSpec->tWCK2DQO + tBURST;
-    tWRSRE = memSpec->tWL + memSpec->tWCK2CKPIN + memSpec->tWCK2CK + memSpec->tWCK2DQI + tBURST;
-    tRDWR_R = memSpec->tCL + tBURST + memSpec->tRTRS - memSpec->tWL;
-    tWRRD_R = memSpec->tWL + tBURST + memSpec->tRTRS - memSpec->tCL;
-    tWRRD_S = memSpec->tWL + tBURST + memSpec->tWTRS;
-    tWRRD_L = memSpec->tWL + tBURST + memSpec->tWTRL;
-    tWRPRE = memSpec->tWL + tBURST + memSpec->tWR;
+    tCL = memSpec->timeToCycles(memSpec->tCL);
+    tWCK2CKPIN = memSpec->timeToCycles(memSpec->tWCK2CKPIN);
+    tWCK2CK = memSpec->timeToCycles(memSpec->tWCK2CK);
+    tWCK2DQO = memSpec->timeToCycles(memSpec->tWCK2DQO);
+    tWL = memSpec->timeToCycles(memSpec->tWL);
+    tWCK2DQI = memSpec->timeToCycles(memSpec->tWCK2DQI);
+    tRTRS = memSpec->timeToCycles(memSpec->tRTRS);
+    tWTRS = memSpec->timeToCycles(memSpec->tWTRS);
+    tWTRL = memSpec->timeToCycles(memSpec->tWTRL);
+    tWR = memSpec->timeToCycles(memSpec->tWR);
+    tRC = memSpec->timeToCycles(memSpec->tRC);
+    tRCDRD = memSpec->timeToCycles(memSpec->tRCDRD);
+    tCCDL = memSpec->timeToCycles(memSpec->tCCDL);
+    tCCDS = memSpec->timeToCycles(memSpec->tCCDS);
+    tRTP = memSpec->timeToCycles(memSpec->tRTP);
+    tXPN = memSpec->timeToCycles(memSpec->tXPN);
+    tLK = memSpec->timeToCycles(memSpec->tLK);
+    tRCDWR = memSpec->timeToCycles(memSpec->tRCDWR);
+    tRTW = memSpec->timeToCycles(memSpec->tRTW);
+    tRRDL = memSpec->timeToCycles(memSpec->tRRDL);
+    tRRDS = memSpec->timeToCycles(memSpec->tRRDS);
+    tRP = memSpec->timeToCycles(memSpec->tRP);
+    tRFC = memSpec->timeToCycles(memSpec->tRFC);
+    tRFCPB = memSpec->timeToCycles(memSpec->tRFCPB);
+    tRREFD = memSpec->timeToCycles(memSpec->tRREFD);
+    tXS = memSpec->timeToCycles(memSpec->tXS);
+    tFAW = memSpec->timeToCycles(memSpec->tFAW);
+    t32AW = memSpec->timeToCycles(memSpec->t32AW);
+    tRAS = memSpec->timeToCycles(memSpec->tRAS);
+    tPPD = memSpec->timeToCycles(memSpec->tPPD);
+    tPD = memSpec->timeToCycles(memSpec->tPD);
+    tCKE = memSpec->timeToCycles(memSpec->tCKE);
+
+    tBURST = memSpec->burstLength / memSpec->dataRate;
+    tRDSRE = tCL + tWCK2CKPIN + tWCK2CK + tWCK2DQO + tBURST;
+    tWRSRE = tWL + tWCK2CKPIN + tWCK2CK + tWCK2DQI + tBURST;
+    tRDWR_R = tCL + tBURST + tRTRS - tWL;
+    tWRRD_R = tWL + tBURST + tRTRS - tCL;
+    tWRRD_S = tWL + tBURST + tWTRS;
+    tWRRD_L = tWL + tBURST + tWTRL;
+    tWRPRE = tWL + tBURST + tWR;
 }
 
-sc_time CheckerGDDR5::timeToSatisfyConstraints(Command command, Rank rank, BankGroup bankgroup, Bank bank) const
+uint64_t CheckerGDDR5::timeToSatisfyConstraints(Command command, Rank rank, BankGroup bankgroup, Bank bank) const
 {
-    sc_time lastCommandStart;
-    sc_time earliestTimeToStart = sc_time_stamp();
+    uint64_t lastCommandStart;
+    uint64_t earliestTimeToStart = currentCycle;
 
     if (command == Command::RD || command == Command::RDA)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRCDRD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRCDRD);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::RD][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDS);
 
-        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::RDA][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDS);
 
-        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         if (command == Command::RDA)
         {
             lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
-            if (lastCommandStart != SC_ZERO_TIME)
-                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE - memSpec->tRTP);
+            if (lastCommandStart != 0)
+                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE - tRTP);
         }
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WR][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_S);
 
-        lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
+        lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : 0;
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WRA][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_L);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_S);
 
-        lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
+        lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : 0;
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRRD_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tLK);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tLK);
     }
     else if (command == Command::WR || command == Command::WRA)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRCDWR);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRCDWR);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTW);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTW);
 
-        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
+        lastCommandStart = lastScheduledByCommand[Command::RD] != lastScheduledByCommandAndRank[Command::RD][rank.ID()] ? lastScheduledByCommand[Command::RD] : 0;
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTW);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTW);
 
-        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
+        lastCommandStart = lastScheduledByCommand[Command::RDA] != lastScheduledByCommandAndRank[Command::RDA][rank.ID()] ? lastScheduledByCommand[Command::RDA] : 0;
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDWR_R);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WR][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDS);
 
-        lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::WR] != lastScheduledByCommandAndRank[Command::WR][rank.ID()] ? lastScheduledByCommand[Command::WR] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::WRA][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCCDS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCCDS);
 
-        lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : SC_ZERO_TIME;
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + memSpec->tRTRS);
+        lastCommandStart = lastScheduledByCommand[Command::WRA] != lastScheduledByCommandAndRank[Command::WRA][rank.ID()] ? lastScheduledByCommand[Command::WRA] : 0;
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tBURST + tRTRS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tLK);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tLK);
     }
     else if (command == Command::ACT)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::ACT][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRDL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRRDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRDS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRRDS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTP + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PRE][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::REFB][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFCPB);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFCPB);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFB][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRREFD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRREFD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
 
         if (last4Activates[rank.ID()].size() >= 4)
-            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + memSpec->tFAW);
+            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + tFAW);
 
         if (last32Activates[rank.ID()].size() >= 32)
-            earliestTimeToStart = std::max(earliestTimeToStart, last32Activates[rank.ID()].front() + memSpec->t32AW);
+            earliestTimeToStart = std::max(earliestTimeToStart, last32Activates[rank.ID()].front() + t32AW);
     }
     else if (command == Command::PRE)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRAS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RD][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WR][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPPD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPPD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
     }
     else if (command == Command::PREA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRAS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRAS);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPPD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPPD);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFB][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFCPB);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFCPB);
     }
     else if (command == Command::REFA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTP + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFB][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFCPB);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFCPB);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
     }
     else if (command == Command::REFB)
     {
         lastCommandStart = lastScheduledByCommandAndBank[Command::ACT][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndBankGroup[Command::ACT][bankgroup.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRDL);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRRDL);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRRDS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRRDS);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::RDA][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRTP + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRTP + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::WRA][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::PRE][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndBank[Command::REFB][bank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFCPB);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFCPB);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFB][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
         {
             if (bankwiseRefreshCounter[rank.ID()] == 0)
-                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFCPB);
+                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFCPB);
             else
-                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRREFD);
+                earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRREFD);
         }
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
 
         if (last4Activates[rank.ID()].size() >= 4)
-            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + memSpec->tFAW);
+            earliestTimeToStart = std::max(earliestTimeToStart, last4Activates[rank.ID()].front() + tFAW);
 
         if (last32Activates[rank.ID()].size() >= 32)
-            earliestTimeToStart = std::max(earliestTimeToStart, last32Activates[rank.ID()].front() + memSpec->t32AW);
+            earliestTimeToStart = std::max(earliestTimeToStart, last32Activates[rank.ID()].front() + t32AW);
     }
     else if (command == Command::PDEA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WR][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
     }
     else if (command == Command::PDXA)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPD);
     }
     else if (command == Command::PDEP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
     }
     else if (command == Command::PDXP)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDEP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tPD);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tPD);
     }
     else if (command == Command::SREFEN)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::ACT][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RD][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
+        if (lastCommandStart != 0)
             earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRDSRE);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::RDA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(memSpec->tRTP + memSpec->tRP, tRDSRE));
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + std::max(tRTP + tRP, tRDSRE));
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::WRA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tWRPRE + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PRE][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PREA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRP);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRP);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::PDXP][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXPN);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXPN);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFA][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFC);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFC);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::REFB][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tRFCPB);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tRFCPB);
 
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEX][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tXS);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tXS);
     }
     else if (command == Command::SREFEX)
     {
         lastCommandStart = lastScheduledByCommandAndRank[Command::SREFEN][rank.ID()];
-        if (lastCommandStart != SC_ZERO_TIME)
-            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + memSpec->tCKE);
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + tCKE);
     }
     else
         SC_REPORT_FATAL("CheckerGDDR5", "Unknown command!");
 
     // Check if command bus is free
-    earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + memSpec->tCK);
+    earliestTimeToStart = std::max(earliestTimeToStart, lastCommandOnBus + 1);
 
     return earliestTimeToStart;
 }
@@ -529,11 +562,11 @@ void CheckerGDDR5::insert(Command command, Rank rank, BankGroup bankgroup, Bank
     PRINTDEBUGMESSAGE("CheckerGDDR5", "Changing state on bank " + std::to_string(bank.ID())
                       + " command is " + commandToString(command));
 
-    lastScheduledByCommandAndBank[command][bank.ID()] = sc_time_stamp();
-    lastScheduledByCommandAndBankGroup[command][bankgroup.ID()] = sc_time_stamp();
-    lastScheduledByCommandAndRank[command][rank.ID()] = sc_time_stamp();
-    lastScheduledByCommand[command] = sc_time_stamp();
-    lastCommandOnBus = sc_time_stamp();
+    lastScheduledByCommandAndBank[command][bank.ID()] = currentCycle;
+    lastScheduledByCommandAndBankGroup[command][bankgroup.ID()] = currentCycle;
+    lastScheduledByCommandAndRank[command][rank.ID()] = currentCycle;
+    lastScheduledByCommand[command] = currentCycle;
+    lastCommandOnBus = currentCycle;
 
     if (command == Command::ACT || command == Command::REFB)
     {
@@ -44,34 +44,68 @@
 class CheckerGDDR5 final : public CheckerIF
 {
 public:
-    CheckerGDDR5();
-    virtual sc_time timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
+    CheckerGDDR5(const uint64_t &currentCycle);
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
     virtual void insert(Command, Rank, BankGroup, Bank) override;
 
 private:
     const MemSpecGDDR5 *memSpec;
 
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndBank;
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndBankGroup;
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndRank;
-    std::vector<sc_time> lastScheduledByCommand;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndBank;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndBankGroup;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndRank;
+    std::vector<uint64_t> lastScheduledByCommand;
 
-    sc_time lastCommandOnBus;
+    uint64_t lastCommandOnBus = 0;
 
     // 4 and 32 activate window
-    std::vector<std::queue<sc_time>> last4Activates;
-    std::vector<std::queue<sc_time>> last32Activates;
+    std::vector<std::queue<uint64_t>> last4Activates;
+    std::vector<std::queue<uint64_t>> last32Activates;
 
     std::vector<unsigned> bankwiseRefreshCounter;
 
-    sc_time tBURST;
-    sc_time tRDSRE;
-    sc_time tWRSRE;
-    sc_time tRDWR_R;
-    sc_time tWRRD_S;
-    sc_time tWRRD_L;
-    sc_time tWRRD_R;
-    sc_time tWRPRE;
+    // Timing constraints in clock cycles
+    uint64_t tCL;
+    uint64_t tWCK2CKPIN;
+    uint64_t tWCK2CK;
+    uint64_t tWCK2DQO;
+    uint64_t tWL;
+    uint64_t tWCK2DQI;
+    uint64_t tRTRS;
+    uint64_t tWTRS;
+    uint64_t tWTRL;
+    uint64_t tWR;
+    uint64_t tRC;
+    uint64_t tRCDRD;
+    uint64_t tCCDL;
+    uint64_t tCCDS;
+    uint64_t tRTP;
+    uint64_t tXPN;
+    uint64_t tLK;
+    uint64_t tRCDWR;
+    uint64_t tRTW;
+    uint64_t tRRDL;
+    uint64_t tRRDS;
+    uint64_t tRP;
+    uint64_t tRFC;
+    uint64_t tRFCPB;
+    uint64_t tRREFD;
+    uint64_t tXS;
+    uint64_t tFAW;
+    uint64_t t32AW;
+    uint64_t tRAS;
+    uint64_t tPPD;
+    uint64_t tPD;
+    uint64_t tCKE;
+
+    uint64_t tBURST;
+    uint64_t tRDSRE;
+    uint64_t tWRSRE;
+    uint64_t tRDWR_R;
+    uint64_t tWRRD_S;
+    uint64_t tWRRD_L;
+    uint64_t tWRRD_R;
+    uint64_t tWRPRE;
 };
 
 #endif // CHECKERGDDR5_H
@@ -44,35 +44,63 @@
 class CheckerHBM2 final : public CheckerIF
 {
 public:
-    CheckerHBM2();
-    virtual sc_time timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
+    CheckerHBM2(const uint64_t &currentCycle);
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
     virtual void insert(Command, Rank, BankGroup, Bank) override;
 
 private:
     const MemSpecHBM2 *memSpec;
 
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndBank;
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndBankGroup;
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndRank;
-    std::vector<sc_time> lastScheduledByCommand;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndBank;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndBankGroup;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndRank;
+    std::vector<uint64_t> lastScheduledByCommand;
 
-    sc_time lastCommandOnRasBus;
-    sc_time lastCommandOnCasBus;
+    uint64_t lastCommandOnRasBus = 0;
+    uint64_t lastCommandOnCasBus = 0;
 
     // Four activate window
-    std::vector<std::queue<sc_time>> last4Activates;
+    std::vector<std::queue<uint64_t>> last4Activates;
     std::vector<unsigned> bankwiseRefreshCounter;
 
-    sc_time tBURST;
-    sc_time tRDPDE;
-    sc_time tRDSRE;
-    sc_time tWRPRE;
-    sc_time tWRPDE;
-    sc_time tWRAPDE;
-    sc_time tRTWR;
-    sc_time tWRRDS;
-    sc_time tWRRDL;
-    sc_time tWRRDR;
+    // Timing constraints in clock cycles
+    uint64_t tRL;
+    uint64_t tPL;
+    uint64_t tWL;
+    uint64_t tWR;
+    uint64_t tWTRS;
+    uint64_t tWTRL;
+    uint64_t tRC;
+    uint64_t tRCDRD;
+    uint64_t tCCDL;
+    uint64_t tCCDS;
+    uint64_t tRTP;
+    uint64_t tXP;
+    uint64_t tRCDWR;
+    uint64_t tRTW;
+    uint64_t tRRDL;
+    uint64_t tRRDS;
+    uint64_t tRP;
+    uint64_t tRFC;
+    uint64_t tRFCSB;
+    uint64_t tRREFD;
+    uint64_t tXS;
+    uint64_t tFAW;
+    uint64_t tRAS;
+    uint64_t tCKE;
+    uint64_t tPD;
+    uint64_t tCKESR;
+
+    uint64_t tBURST;
+    uint64_t tRDPDE;
+    uint64_t tRDSRE;
+    uint64_t tWRPRE;
+    uint64_t tWRPDE;
+    uint64_t tWRAPDE;
+    uint64_t tRTWR;
+    uint64_t tWRRDS;
+    uint64_t tWRRDL;
+    uint64_t tWRRDR;
 };
 
 #endif // CHECKERHBM2_H
@@ -44,10 +44,22 @@
 class CheckerIF
 {
 public:
+    // The current cycle is owned by the controller and updated once per evaluation
+    CheckerIF(const uint64_t &currentCycle) : currentCycle(currentCycle) {}
     virtual ~CheckerIF() {}
 
-    virtual sc_time timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const = 0;
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const = 0;
     virtual void insert(Command, Rank, BankGroup, Bank) = 0;
+
+    // Earliest issue times of one command for all banks of a rank, indexed by the bank ID within the rank
+    virtual void timeToSatisfyConstraintsOnRank(Command, Rank, uint64_t *earliestTimes) const;
+    // True if the rank evaluation above is cheaper than one scalar query per bank
+    virtual bool evaluatesRankNatively() const { return false; }
+
+    virtual void printStatistics(const std::string &) const {}
+
+protected:
+    const uint64_t &currentCycle;
 };
 
 #endif // CHECKERIF_H
@@ -44,38 +44,67 @@
 class CheckerLPDDR4 final : public CheckerIF
 {
 public:
-    CheckerLPDDR4();
-    virtual sc_time timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
+    CheckerLPDDR4(const uint64_t &currentCycle);
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
     virtual void insert(Command, Rank, BankGroup, Bank) override;
 
 private:
     const MemSpecLPDDR4 *memSpec;
 
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndBank;
-    std::vector<std::vector<sc_time>> lastScheduledByCommandAndRank;
-    std::vector<sc_time> lastScheduledByCommand;
-    sc_time lastCommandOnBus;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndBank;
+    std::vector<std::vector<uint64_t>> lastScheduledByCommandAndRank;
+    std::vector<uint64_t> lastScheduledByCommand;
+    uint64_t lastCommandOnBus = 0;
 
     // Four activate window
-    std::vector<std::queue<sc_time>> last4Activates;
+    std::vector<std::queue<uint64_t>> last4Activates;
 
-    sc_time tBURST;
-    sc_time tRDWR;
-    sc_time tRDWR_R;
-    sc_time tWRRD;
-    sc_time tWRRD_R;
-    sc_time tRDPRE;
-    sc_time tRDAPRE;
-    sc_time tRDAACT;
-    sc_time tWRPRE;
-    sc_time tWRAPRE;
-    sc_time tWRAACT;
-    sc_time tACTPDEN;
-    sc_time tPRPDEN;
-    sc_time tRDPDEN;
-    sc_time tWRPDEN;
-    sc_time tWRAPDEN;
-    sc_time tREFPDEN;
+    // Timing constraints in clock cycles
+    uint64_t tRL;
+    uint64_t tDQSCK;
+    uint64_t tWL;
+    uint64_t tWPRE;
+    uint64_t tRPST;
+    uint64_t tRTRS;
+    uint64_t tWTR;
+    uint64_t tRTP;
+    uint64_t tRPpb;
+    uint64_t tWR;
+    uint64_t tCMDCKE;
+    uint64_t tDQSS;
+    uint64_t tDQS2DQ;
+    uint64_t tRCD;
+    uint64_t tCCD;
+    uint64_t tXP;
+    uint64_t tRCpb;
+    uint64_t tRRD;
+    uint64_t tRPab;
+    uint64_t tRFCab;
+    uint64_t tRFCpb;
+    uint64_t tXSR;
+    uint64_t tFAW;
+    uint64_t tRAS;
+    uint64_t tPPD;
+    uint64_t tCKE;
+    uint64_t tSR;
+
+    uint64_t tBURST;
+    uint64_t tRDWR;
+    uint64_t tRDWR_R;
+    uint64_t tWRRD;
+    uint64_t tWRRD_R;
+    uint64_t tRDPRE;
+    uint64_t tRDAPRE;
+    uint64_t tRDAACT;
+    uint64_t tWRPRE;
+    uint64_t tWRAPRE;
+    uint64_t tWRAACT;
+    uint64_t tACTPDEN;
+    uint64_t tPRPDEN;
+    uint64_t tRDPDEN;
+    uint64_t tWRPDEN;
+    uint64_t tWRAPDEN;
+    uint64_t tREFPDEN;
 };
 
 #endif // CHECKERLPDDR4_H
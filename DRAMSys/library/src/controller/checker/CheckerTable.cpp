@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+
+#include "CheckerTable.h"
+#include "../../configuration/Configuration.h"
+#include <algorithm>
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+// earliestTimes[i] = max(earliestTimes[i], lastTimes[i] + delay) for all lastTimes[i] != 0
+// The vector paths are selected with the CMake option DRAMSYS_CHECKER_SIMD
+static void updateEarliestTimes(uint64_t *earliestTimes, const uint64_t *lastTimes, uint64_t delay, unsigned count)
+{
+    unsigned i = 0;
+
+    // Signed 64 bit comparisons are sufficient because cycles never reach 2^63
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i delays = _mm256_set1_epi64x(static_cast<long long>(delay));
+    for (; i + 4 <= count; i += 4)
+    {
+        __m256i last = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lastTimes + i));
+        __m256i earliest = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(earliestTimes + i));
+        __m256i candidate = _mm256_andnot_si256(_mm256_cmpeq_epi64(last, zero), _mm256_add_epi64(last, delays));
+        __m256i greater = _mm256_cmpgt_epi64(candidate, earliest);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(earliestTimes + i),
+                            _mm256_blendv_epi8(earliest, candidate, greater));
+    }
+#elif defined(__SSE4_2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i delays = _mm_set1_epi64x(static_cast<long long>(delay));
+    for (; i + 2 <= count; i += 2)
+    {
+        __m128i last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lastTimes + i));
+        __m128i earliest = _mm_loadu_si128(reinterpret_cast<const __m128i *>(earliestTimes + i));
+        __m128i candidate = _mm_andnot_si128(_mm_cmpeq_epi64(last, zero), _mm_add_epi64(last, delays));
+        __m128i greater = _mm_cmpgt_epi64(candidate, earliest);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(earliestTimes + i),
+                         _mm_blendv_epi8(earliest, candidate, greater));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (lastTimes[i] != 0)
+            earliestTimes[i] = std::max(earliestTimes[i], lastTimes[i] + delay);
+    }
+}
+
+CheckerTable::CheckerTable(const uint64_t &currentCycle) : CheckerIF(currentCycle)
+{
+    memSpec = Configuration::getInstance().memSpec;
+
+    firstConstraint = std::vector<unsigned>(numberOfCommands() + 1, 0);
+
+    bankGroupOffset = numberOfCommands() * memSpec->numberOfBanks;
+    rankOffset = bankGroupOffset + numberOfCommands() * memSpec->numberOfBankGroups;
+    channelOffset = rankOffset + numberOfCommands() * memSpec->numberOfRanks;
+    lastScheduled = std::vector<uint64_t>(channelOffset + numberOfCommands());
+
+    supported = std::vector<bool>(numberOfCommands(), false);
+    countsForWindow = std::vector<bool>(numberOfCommands(), false);
+    windowDelay = std::vector<uint64_t>(numberOfCommands(), 0);
+    lastActivates = std::vector<std::queue<uint64_t>>(memSpec->numberOfRanks);
+
+    dependents = std::vector<std::vector<Dependent>>(numberOfCommands());
+    cachedTime = std::vector<uint64_t>(numberOfCommands() * memSpec->numberOfBanks, MAX_CYCLE);
+}
+
+void CheckerTable::addConstraint(std::initializer_list<Command> commands, Command previousCommand,
+                                 Scope scope, uint64_t delay)
+{
+    TimingConstraint constraint;
+    constraint.scope = scope;
+    constraint.delay = delay;
+    constraint.rankIndex = rankOffset + previousCommand * memSpec->numberOfRanks;
+
+    if (scope == Scope::Bank)
+        constraint.index = previousCommand * memSpec->numberOfBanks;
+    else if (scope == Scope::BankGroup)
+        constraint.index = bankGroupOffset + previousCommand * memSpec->numberOfBankGroups;
+    else if (scope == Scope::Rank)
+        constraint.index = rankOffset + previousCommand * memSpec->numberOfRanks;
+    else
+        constraint.index = channelOffset + previousCommand;
+
+    // Keep the constraints of each command contiguous
+    for (auto command : commands)
+    {
+        supported[command] = true;
+        bool known = false;
+        for (auto dependent : dependents[previousCommand])
+        {
+            if (dependent.command == command && dependent.scope == scope)
+                known = true;
+        }
+        if (!known)
+            dependents[previousCommand].push_back(Dependent{command, scope});
+
+        constraints.insert(constraints.begin() + firstConstraint[command + 1], constraint);
+        for (unsigned i = command + 1; i < firstConstraint.size(); i++)
+            firstConstraint[i]++;
+    }
+}
+
+void CheckerTable::setActivateWindow(unsigned size, std::initializer_list<Command> commands)
+{
+    windowSize = size;
+    for (auto command : commands)
+        countsForWindow[command] = true;
+}
+
+void CheckerTable::addWindowConstraint(std::initializer_list<Command> commands, uint64_t delay)
+{
+    for (auto command : commands)
+    {
+        supported[command] = true;
+        windowDelay[command] = delay;
+    }
+}
+
+uint64_t CheckerTable::timeToSatisfyConstraints(Command command, Rank rank, BankGroup bankgroup, Bank bank) const
+{
+    unsigned unit = isRankCommand(command) ? rank.ID() : bank.ID();
+    uint64_t &cached = cachedTime[command * memSpec->numberOfBanks + unit];
+
+    if (cached == MAX_CYCLE)
+    {
+        cacheMisses++;
+        cached = evaluateConstraints(command, rank, bankgroup, bank);
+    }
+    else
+        cacheHits++;
+
+    // The current cycle and the command bus change without an insert of a dependent command
+    return std::max({cached, currentCycle, lastCommandOnBus + 1});
+}
+
+void CheckerTable::timeToSatisfyConstraintsOnRank(Command command, Rank rank, uint64_t *earliestTimes) const
+{
+    unsigned banksPerRank = memSpec->banksPerRank;
+
+    // Rank commands are independent of the bank
+    if (isRankCommand(command))
+    {
+        uint64_t earliestTimeToStart = timeToSatisfyConstraints(command, rank, BankGroup(0), Bank(0));
+        for (unsigned bankID = 0; bankID < banksPerRank; bankID++)
+            earliestTimes[bankID] = earliestTimeToStart;
+        return;
+    }
+
+    if (!supported[command])
+        SC_REPORT_FATAL("CheckerTable", "Unknown command!");
+
+    // Rank, other rank and channel constraints are equal for all banks of the rank
+    uint64_t commonTime = std::max(currentCycle, lastCommandOnBus + 1);
+    for (unsigned i = firstConstraint[command]; i < firstConstraint[command + 1]; i++)
+    {
+        const TimingConstraint &constraint = constraints[i];
+        uint64_t lastCommandStart;
+
+        if (constraint.scope == Scope::Rank)
+            lastCommandStart = lastScheduled[constraint.index + rank.ID()];
+        else if (constraint.scope == Scope::OtherRank)
+        {
+            lastCommandStart = lastScheduled[constraint.index];
+            if (lastCommandStart == lastScheduled[constraint.rankIndex + rank.ID()])
+                lastCommandStart = 0;
+        }
+        else if (constraint.scope == Scope::Channel)
+            lastCommandStart = lastScheduled[constraint.index];
+        else
+            continue;
+
+        if (lastCommandStart != 0)
+            commonTime = std::max(commonTime, lastCommandStart + constraint.delay);
+    }
+
+    if (windowDelay[command] != 0 && lastActivates[rank.ID()].size() >= windowSize)
+        commonTime = std::max(commonTime, lastActivates[rank.ID()].front() + windowDelay[command]);
+
+    for (unsigned bankID = 0; bankID < banksPerRank; bankID++)
+        earliestTimes[bankID] = commonTime;
+
+    // Bank and bank group constraints, the banks of one rank are contiguous in each command row
+    unsigned firstBank = rank.ID() * banksPerRank;
+    unsigned firstBankGroup = rank.ID() * memSpec->groupsPerRank;
+
+    for (unsigned i = firstConstraint[command]; i < firstConstraint[command + 1]; i++)
+    {
+        const TimingConstraint &constraint = constraints[i];
+
+        if (constraint.scope == Scope::Bank)
+            updateEarliestTimes(earliestTimes, &lastScheduled[constraint.index + firstBank], constraint.delay, banksPerRank);
+        else if (constraint.scope == Scope::BankGroup)
+        {
+            for (unsigned groupID = 0; groupID < memSpec->groupsPerRank; groupID++)
+            {
+                uint64_t lastCommandStart = lastScheduled[constraint.index + firstBankGroup + groupID];
+                if (lastCommandStart != 0)
+                {
+                    for (unsigned bankID = groupID * memSpec->banksPerGroup;
+                         bankID < (groupID + 1) * memSpec->banksPerGroup; bankID++)
+                        earliestTimes[bankID] = std::max(earliestTimes[bankID], lastCommandStart + constraint.delay);
+                }
+            }
+        }
+    }
+}
+
+uint64_t CheckerTable::evaluateConstraints(Command command, Rank rank, BankGroup bankgroup, Bank bank) const
+{
+    // Only reached on a cache miss, so cached queries are not slowed down by the check
+    if (!supported[command])
+        SC_REPORT_FATAL("CheckerTable", "Unknown command!");
+
+    uint64_t earliestTimeToStart = 0;
+
+    // Offset of the addressed unit within each scope (OtherRank and Channel use the channel entry)
+    const unsigned unitOffset[] = {bank.ID(), bankgroup.ID(), rank.ID(), 0, 0};
+
+    for (unsigned i = firstConstraint[command]; i < firstConstraint[command + 1]; i++)
+    {
+        const TimingConstraint &constraint = constraints[i];
+        uint64_t lastCommandStart = lastScheduled[constraint.index + unitOffset[static_cast<unsigned>(constraint.scope)]];
+
+        // Only consider the last command on the channel if it was not issued to the same rank
+        if (constraint.scope == Scope::OtherRank && lastCommandStart == lastScheduled[constraint.rankIndex + rank.ID()])
+            lastCommandStart = 0;
+
+        if (lastCommandStart != 0)
+            earliestTimeToStart = std::max(earliestTimeToStart, lastCommandStart + constraint.delay);
+    }
+
+    if (windowDelay[command] != 0 && lastActivates[rank.ID()].size() >= windowSize)
+        earliestTimeToStart = std::max(earliestTimeToStart, lastActivates[rank.ID()].front() + windowDelay[command]);
+
+    return earliestTimeToStart;
+}
+
+void CheckerTable::invalidate(Command command, unsigned firstBank, unsigned lastBank)
+{
+    unsigned offset = command * memSpec->numberOfBanks;
+
+    if (isRankCommand(command))
+    {
+        for (unsigned rank = firstBank / memSpec->banksPerRank; rank <= (lastBank - 1) / memSpec->banksPerRank; rank++)
+            cachedTime[offset + rank] = MAX_CYCLE;
+    }
+    else
+    {
+        for (unsigned bank = firstBank; bank < lastBank; bank++)
+            cachedTime[offset + bank] = MAX_CYCLE;
+    }
+}
+
+void CheckerTable::insert(Command command, Rank rank, BankGroup bankgroup, Bank bank)
+{
+    PRINTDEBUGMESSAGE("CheckerTable", "Changing state on bank " + std::to_string(bank.ID())
+                      + " command is " + commandToString(command));
+
+    lastScheduled[command * memSpec->numberOfBanks + bank.ID()] = currentCycle;
+    lastScheduled[bankGroupOffset + command * memSpec->numberOfBankGroups + bankgroup.ID()] = currentCycle;
+    lastScheduled[rankOffset + command * memSpec->numberOfRanks + rank.ID()] = currentCycle;
+    lastScheduled[channelOffset + command] = currentCycle;
+
+    lastCommandOnBus = currentCycle + memSpec->timeToCycles(memSpec->getCommandLength(command)) - 1;
+
+    if (countsForWindow[command])
+    {
+        if (lastActivates[rank.ID()].size() == windowSize)
+            lastActivates[rank.ID()].pop();
+        lastActivates[rank.ID()].push(lastCommandOnBus);
+    }
+
+    unsigned firstBankOnRank = rank.ID() * memSpec->banksPerRank;
+    unsigned firstBankInGroup = bankgroup.ID() * memSpec->banksPerGroup;
+
+    for (auto dependent : dependents[command])
+    {
+        // Rank commands are queried with bank 0 and bank group 0 of their rank, so bank and bank group
+        // constraints of rank commands are invalidated on all ranks
+        if (isRankCommand(dependent.command) && (dependent.scope == Scope::Bank || dependent.scope == Scope::BankGroup))
+            invalidate(dependent.command, 0, memSpec->numberOfBanks);
+        else if (dependent.scope == Scope::Bank)
+            invalidate(dependent.command, bank.ID(), bank.ID() + 1);
+        else if (dependent.scope == Scope::BankGroup)
+            invalidate(dependent.command, firstBankInGroup, firstBankInGroup + memSpec->banksPerGroup);
+        else if (dependent.scope == Scope::Rank)
+            invalidate(dependent.command, firstBankOnRank, firstBankOnRank + memSpec->banksPerRank);
+        else
+            invalidate(dependent.command, 0, memSpec->numberOfBanks);
+    }
+
+    if (countsForWindow[command])
+    {
+        for (unsigned i = 0; i < numberOfCommands(); i++)
+        {
+            if (windowDelay[i] != 0)
+                invalidate(static_cast<Command>(i), firstBankOnRank, firstBankOnRank + memSpec->banksPerRank);
+        }
+    }
+}
+
+void CheckerTable::printStatistics(const std::string &name) const
+{
+    std::cout << name << std::string("  Checker cache hits:   ") << cacheHits << std::endl;
+    std::cout << name << std::string("  Checker cache misses: ") << cacheMisses << std::endl;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+
+#ifndef CHECKERTABLE_H
+#define CHECKERTABLE_H
+
+#include "CheckerIF.h"
+#include <queue>
+#include <vector>
+#include <initializer_list>
+#include "../../configuration/memspec/MemSpec.h"
+
+// Generic timing checker: each standard declares its constraints as (previous command, scope, delay)
+// entries and all of them are evaluated by one loop over a flat table
+class CheckerTable : public CheckerIF
+{
+public:
+    virtual uint64_t timeToSatisfyConstraints(Command, Rank, BankGroup, Bank) const override;
+    virtual void insert(Command, Rank, BankGroup, Bank) override;
+    virtual void timeToSatisfyConstraintsOnRank(Command, Rank, uint64_t *earliestTimes) const override;
+    virtual bool evaluatesRankNatively() const override { return true; }
+    virtual void printStatistics(const std::string &) const override;
+
+protected:
+    enum class Scope {Bank, BankGroup, Rank, OtherRank, Channel};
+
+    CheckerTable(const uint64_t &currentCycle);
+    void addConstraint(std::initializer_list<Command>, Command previousCommand, Scope, uint64_t delay);
+    void setActivateWindow(unsigned size, std::initializer_list<Command>);
+    void addWindowConstraint(std::initializer_list<Command>, uint64_t delay);
+
+private:
+    struct TimingConstraint
+    {
+        Scope scope;
+        unsigned index;
+        unsigned rankIndex;
+        uint64_t delay;
+    };
+
+    struct Dependent
+    {
+        Command command;
+        Scope scope;
+    };
+
+    uint64_t evaluateConstraints(Command, Rank, BankGroup, Bank) const;
+    void invalidate(Command, unsigned firstBank, unsigned lastBank);
+
+    const MemSpec *memSpec;
+
+    // Constraints of command c are stored in [firstConstraint[c], firstConstraint[c + 1])
+    std::vector<TimingConstraint> constraints;
+    std::vector<unsigned> firstConstraint;
+
+    // Last issue times of all scopes in one array: [bank][bankgroup][rank][channel], each ordered by command,
+    // so the bank entries of one command and rank are contiguous and can be evaluated with vector instructions
+    std::vector<uint64_t> lastScheduled;
+    unsigned bankGroupOffset;
+    unsigned rankOffset;
+    unsigned channelOffset;
+    uint64_t lastCommandOnBus = 0;
+
+    // Commands that have constraints in the table, all others are unknown to the standard
+    std::vector<bool> supported;
+
+    // Sliding activate window (e.g. tFAW)
+    unsigned windowSize = 0;
+    std::vector<bool> countsForWindow;
+    std::vector<uint64_t> windowDelay;
+    std::vector<std::queue<uint64_t>> lastActivates;
+
+    // Memoized constraint results per [command][bank] (rank commands per [command][rank]), MAX_CYCLE if invalid.
+    // An insert only invalidates the entries of commands that depend on it within the affected scope.
+    std::vector<std::vector<Dependent>> dependents;
+    mutable std::vector<uint64_t> cachedTime;
+    mutable uint64_t cacheHits = 0;
+    mutable uint64_t cacheMisses = 0;
+};
+
+#endif // CHECKERTABLE_H
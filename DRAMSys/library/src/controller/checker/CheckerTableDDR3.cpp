@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+
+#include "CheckerTableDDR3.h"
+#include "../../configuration/Configuration.h"
+
+CheckerTableDDR3::CheckerTableDDR3(const uint64_t &currentCycle) : CheckerTable(currentCycle)
+{
+    const MemSpecDDR3 *memSpec = dynamic_cast<MemSpecDDR3 *>(Configuration::getInstance().memSpec);
+    if (memSpec == nullptr)
+        SC_REPORT_FATAL("CheckerTableDDR3", "Wrong MemSpec chosen");
+
+    uint64_t tRL = memSpec->timeToCycles(memSpec->tRL);
+    uint64_t tWL = memSpec->timeToCycles(memSpec->tWL);
+    uint64_t tRTRS = memSpec->timeToCycles(memSpec->tRTRS);
+    uint64_t tWTR = memSpec->timeToCycles(memSpec->tWTR);
+    uint64_t tWR = memSpec->timeToCycles(memSpec->tWR);
+    uint64_t tRCD = memSpec->timeToCycles(memSpec->tRCD);
+    uint64_t tRC = memSpec->timeToCycles(memSpec->tRC);
+    uint64_t tAL = memSpec->timeToCycles(memSpec->tAL);
+    uint64_t tCCD = memSpec->timeToCycles(memSpec->tCCD);
+    uint64_t tRTP = memSpec->timeToCycles(memSpec->tRTP);
+    uint64_t tXP = memSpec->timeToCycles(memSpec->tXP);
+    uint64_t tXSDLL = memSpec->timeToCycles(memSpec->tXSDLL);
+    uint64_t tXS = memSpec->timeToCycles(memSpec->tXS);
+    uint64_t tRRD = memSpec->timeToCycles(memSpec->tRRD);
+    uint64_t tRP = memSpec->timeToCycles(memSpec->tRP);
+    uint64_t tRFC = memSpec->timeToCycles(memSpec->tRFC);
+    uint64_t tFAW = memSpec->timeToCycles(memSpec->tFAW);
+    uint64_t tRAS = memSpec->timeToCycles(memSpec->tRAS);
+    uint64_t tACTPDEN = memSpec->timeToCycles(memSpec->tACTPDEN);
+    uint64_t tPRPDEN = memSpec->timeToCycles(memSpec->tPRPDEN);
+    uint64_t tCKE = memSpec->timeToCycles(memSpec->tCKE);
+    uint64_t tPD = memSpec->timeToCycles(memSpec->tPD);
+    uint64_t tREFPDEN = memSpec->timeToCycles(memSpec->tREFPDEN);
+    uint64_t tCKESR = memSpec->timeToCycles(memSpec->tCKESR);
+
+    uint64_t tBURST = memSpec->burstLength / memSpec->dataRate;
+    uint64_t tRDWR = tRL + tBURST + 2 - tWL;
+    uint64_t tRDWR_R = tRL + tBURST + tRTRS - tWL;
+    uint64_t tWRRD = tWL + tBURST + tWTR;
+    uint64_t tWRRD_R = tWL + tBURST + tRTRS - tRL;
+    uint64_t tWRPRE = tWL + tBURST + tWR;
+    uint64_t tRDPDEN = tRL + tBURST + 1;
+    uint64_t tWRPDEN = tWL + tBURST + tWR;
+    uint64_t tWRAPDEN = tWL + tBURST + tWR + 1;
+
+    setActivateWindow(4, {Command::ACT});
+
+    // RD, RDA
+    addConstraint({Command::RD, Command::RDA}, Command::ACT, Scope::Bank, tRCD - tAL);
+    addConstraint({Command::RD, Command::RDA}, Command::RD, Scope::Rank, tCCD);
+    addConstraint({Command::RD, Command::RDA}, Command::RD, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::RD, Command::RDA}, Command::RDA, Scope::Rank, tCCD);
+    addConstraint({Command::RD, Command::RDA}, Command::RDA, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::RDA}, Command::WR, Scope::Bank, tWRPRE - tRTP);
+    addConstraint({Command::RD, Command::RDA}, Command::WR, Scope::Rank, tWRRD);
+    addConstraint({Command::RD, Command::RDA}, Command::WR, Scope::Channel, tWRRD_R);
+    addConstraint({Command::RD, Command::RDA}, Command::WRA, Scope::Rank, tWRRD);
+    addConstraint({Command::RD, Command::RDA}, Command::WRA, Scope::Channel, tWRRD_R);
+    addConstraint({Command::RD, Command::RDA}, Command::PDXA, Scope::Rank, tXP);
+    addConstraint({Command::RD, Command::RDA}, Command::SREFEX, Scope::Rank, tXSDLL);
+
+    // WR, WRA
+    addConstraint({Command::WR, Command::WRA}, Command::ACT, Scope::Bank, tRCD - tAL);
+    addConstraint({Command::WR, Command::WRA}, Command::RD, Scope::Rank, tRDWR);
+    addConstraint({Command::WR, Command::WRA}, Command::RD, Scope::OtherRank, tRDWR_R);
+    addConstraint({Command::WR, Command::WRA}, Command::RDA, Scope::Rank, tRDWR);
+    addConstraint({Command::WR, Command::WRA}, Command::RDA, Scope::OtherRank, tRDWR_R);
+    addConstraint({Command::WR, Command::WRA}, Command::WR, Scope::Rank, tCCD);
+    addConstraint({Command::WR, Command::WRA}, Command::WR, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::WR, Command::WRA}, Command::WRA, Scope::Rank, tCCD);
+    addConstraint({Command::WR, Command::WRA}, Command::WRA, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::WR, Command::WRA}, Command::PDXA, Scope::Rank, tXP);
+    addConstraint({Command::WR, Command::WRA}, Command::SREFEX, Scope::Rank, tXSDLL);
+
+    // ACT
+    addConstraint({Command::ACT}, Command::ACT, Scope::Bank, tRC);
+    addConstraint({Command::ACT}, Command::ACT, Scope::Rank, tRRD);
+    addConstraint({Command::ACT}, Command::RDA, Scope::Bank, tAL + tRTP + tRP);
+    addConstraint({Command::ACT}, Command::WRA, Scope::Bank, tWRPRE + tRP);
+    addConstraint({Command::ACT}, Command::PRE, Scope::Bank, tRP);
+    addConstraint({Command::ACT}, Command::PREA, Scope::Rank, tRP);
+    addConstraint({Command::ACT}, Command::PDXA, Scope::Rank, tXP);
+    addConstraint({Command::ACT}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::ACT}, Command::REFA, Scope::Rank, tRFC);
+    addConstraint({Command::ACT}, Command::SREFEX, Scope::Rank, tXS);
+
+    // PRE
+    addConstraint({Command::PRE}, Command::ACT, Scope::Bank, tRAS);
+    addConstraint({Command::PRE}, Command::RD, Scope::Bank, tAL + tRTP);
+    addConstraint({Command::PRE}, Command::WR, Scope::Bank, tWRPRE);
+    addConstraint({Command::PRE}, Command::PDXA, Scope::Rank, tXP);
+
+    // PREA
+    addConstraint({Command::PREA}, Command::ACT, Scope::Rank, tRAS);
+    addConstraint({Command::PREA}, Command::RD, Scope::Rank, tAL + tRTP);
+    addConstraint({Command::PREA}, Command::RDA, Scope::Rank, tAL + tRTP);
+    addConstraint({Command::PREA}, Command::WR, Scope::Rank, tWRPRE);
+    addConstraint({Command::PREA}, Command::WRA, Scope::Rank, tWRPRE);
+    addConstraint({Command::PREA}, Command::PDXA, Scope::Rank, tXP);
+
+    // REFA
+    addConstraint({Command::REFA}, Command::ACT, Scope::Rank, tRC);
+    addConstraint({Command::REFA}, Command::RDA, Scope::Rank, tAL + tRTP + tRP);
+    addConstraint({Command::REFA}, Command::WRA, Scope::Rank, tWRPRE + tRP);
+    addConstraint({Command::REFA}, Command::PRE, Scope::Rank, tRP);
+    addConstraint({Command::REFA}, Command::PREA, Scope::Rank, tRP);
+    addConstraint({Command::REFA}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::REFA}, Command::REFA, Scope::Rank, tRFC);
+    addConstraint({Command::REFA}, Command::SREFEX, Scope::Rank, tXS);
+
+    // PDEA
+    addConstraint({Command::PDEA}, Command::ACT, Scope::Rank, tACTPDEN);
+    addConstraint({Command::PDEA}, Command::RD, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEA}, Command::RDA, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEA}, Command::WR, Scope::Rank, tWRPDEN);
+    addConstraint({Command::PDEA}, Command::WRA, Scope::Rank, tWRAPDEN);
+    addConstraint({Command::PDEA}, Command::PRE, Scope::Rank, tPRPDEN);
+    addConstraint({Command::PDEA}, Command::PDXA, Scope::Rank, tCKE);
+
+    // PDXA
+    addConstraint({Command::PDXA}, Command::PDEA, Scope::Rank, tPD);
+
+    // PDEP
+    addConstraint({Command::PDEP}, Command::RD, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEP}, Command::RDA, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEP}, Command::WRA, Scope::Rank, tWRAPDEN);
+    addConstraint({Command::PDEP}, Command::PRE, Scope::Rank, tPRPDEN);
+    addConstraint({Command::PDEP}, Command::PREA, Scope::Rank, tPRPDEN);
+    addConstraint({Command::PDEP}, Command::PDXP, Scope::Rank, tCKE);
+    addConstraint({Command::PDEP}, Command::REFA, Scope::Rank, tREFPDEN);
+    addConstraint({Command::PDEP}, Command::SREFEX, Scope::Rank, tXS);
+
+    // PDXP
+    addConstraint({Command::PDXP}, Command::PDEP, Scope::Rank, tPD);
+
+    // SREFEN
+    addConstraint({Command::SREFEN}, Command::ACT, Scope::Rank, tRC);
+    addConstraint({Command::SREFEN}, Command::RDA, Scope::Rank, std::max(tRDPDEN, tAL + tRTP + tRP));
+    addConstraint({Command::SREFEN}, Command::WRA, Scope::Rank, std::max(tWRAPDEN, tWRPRE + tRP));
+    addConstraint({Command::SREFEN}, Command::PRE, Scope::Rank, tRP);
+    addConstraint({Command::SREFEN}, Command::PREA, Scope::Rank, tRP);
+    addConstraint({Command::SREFEN}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::SREFEN}, Command::REFA, Scope::Rank, tRFC);
+    addConstraint({Command::SREFEN}, Command::SREFEX, Scope::Rank, tXS);
+
+    // SREFEX
+    addConstraint({Command::SREFEX}, Command::SREFEN, Scope::Rank, tCKESR);
+
+    // Activate window
+    addWindowConstraint({Command::ACT}, tFAW);
+}
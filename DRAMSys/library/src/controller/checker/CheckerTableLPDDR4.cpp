@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+
+#include "CheckerTableLPDDR4.h"
+#include "../../configuration/Configuration.h"
+
+CheckerTableLPDDR4::CheckerTableLPDDR4(const uint64_t &currentCycle) : CheckerTable(currentCycle)
+{
+    const MemSpecLPDDR4 *memSpec = dynamic_cast<MemSpecLPDDR4 *>(Configuration::getInstance().memSpec);
+    if (memSpec == nullptr)
+        SC_REPORT_FATAL("CheckerTableLPDDR4", "Wrong MemSpec chosen");
+
+    uint64_t tRL = memSpec->timeToCycles(memSpec->tRL);
+    uint64_t tDQSCK = memSpec->timeToCycles(memSpec->tDQSCK);
+    uint64_t tWL = memSpec->timeToCycles(memSpec->tWL);
+    uint64_t tWPRE = memSpec->timeToCycles(memSpec->tWPRE);
+    uint64_t tRPST = memSpec->timeToCycles(memSpec->tRPST);
+    uint64_t tRTRS = memSpec->timeToCycles(memSpec->tRTRS);
+    uint64_t tWTR = memSpec->timeToCycles(memSpec->tWTR);
+    uint64_t tRTP = memSpec->timeToCycles(memSpec->tRTP);
+    uint64_t tRPpb = memSpec->timeToCycles(memSpec->tRPpb);
+    uint64_t tWR = memSpec->timeToCycles(memSpec->tWR);
+    uint64_t tCMDCKE = memSpec->timeToCycles(memSpec->tCMDCKE);
+    uint64_t tDQSS = memSpec->timeToCycles(memSpec->tDQSS);
+    uint64_t tDQS2DQ = memSpec->timeToCycles(memSpec->tDQS2DQ);
+    uint64_t tRCD = memSpec->timeToCycles(memSpec->tRCD);
+    uint64_t tCCD = memSpec->timeToCycles(memSpec->tCCD);
+    uint64_t tXP = memSpec->timeToCycles(memSpec->tXP);
+    uint64_t tRCpb = memSpec->timeToCycles(memSpec->tRCpb);
+    uint64_t tRRD = memSpec->timeToCycles(memSpec->tRRD);
+    uint64_t tRPab = memSpec->timeToCycles(memSpec->tRPab);
+    uint64_t tRFCab = memSpec->timeToCycles(memSpec->tRFCab);
+    uint64_t tRFCpb = memSpec->timeToCycles(memSpec->tRFCpb);
+    uint64_t tXSR = memSpec->timeToCycles(memSpec->tXSR);
+    uint64_t tFAW = memSpec->timeToCycles(memSpec->tFAW);
+    uint64_t tRAS = memSpec->timeToCycles(memSpec->tRAS);
+    uint64_t tPPD = memSpec->timeToCycles(memSpec->tPPD);
+    uint64_t tCKE = memSpec->timeToCycles(memSpec->tCKE);
+    uint64_t tSR = memSpec->timeToCycles(memSpec->tSR);
+
+    uint64_t tBURST = memSpec->burstLength / memSpec->dataRate;
+    uint64_t tRDWR = tRL + tDQSCK + tBURST - tWL + tWPRE + tRPST;
+    uint64_t tRDWR_R = tRL + tBURST + tRTRS - tWL;
+    uint64_t tWRRD = tWL + 1 + tBURST + tWTR;
+    uint64_t tWRRD_R = tWL + tBURST + tRTRS - tRL;
+    uint64_t tRDPRE = tRTP + tBURST - 6;
+    uint64_t tRDAACT = tRTP + tBURST - 8 + tRPpb;
+    uint64_t tWRPRE = tWL + tBURST + 1 + tWR + 2;
+    uint64_t tWRAACT = tWL + tBURST + 1 + tWR + tRPpb;
+    uint64_t tACTPDEN = 3 + tCMDCKE;
+    uint64_t tPRPDEN = 1 + tCMDCKE;
+    uint64_t tRDPDEN = 3 + tRL + tDQSCK + tBURST + tRPST;
+    uint64_t tWRPDEN = 3 + tWL + tDQSS + tDQS2DQ + tBURST + tWR;
+    uint64_t tWRAPDEN = 3 + tWL + tDQSS + tDQS2DQ + tBURST + tWR + 2;
+    uint64_t tREFPDEN = 1 + tCMDCKE;
+
+    setActivateWindow(4, {Command::ACT, Command::REFB});
+
+    // RD, RDA
+    addConstraint({Command::RD, Command::RDA}, Command::ACT, Scope::Bank, tRCD);
+    addConstraint({Command::RD, Command::RDA}, Command::RD, Scope::Rank, tCCD);
+    addConstraint({Command::RD, Command::RDA}, Command::RD, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::RD, Command::RDA}, Command::RDA, Scope::Rank, tCCD);
+    addConstraint({Command::RD, Command::RDA}, Command::RDA, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::RDA}, Command::WR, Scope::Bank, tWRPRE - tRDPRE);
+    addConstraint({Command::RD, Command::RDA}, Command::WR, Scope::Rank, tWRRD);
+    addConstraint({Command::RD, Command::RDA}, Command::WR, Scope::OtherRank, tWRRD_R);
+    addConstraint({Command::RD, Command::RDA}, Command::WRA, Scope::Rank, tWRRD);
+    addConstraint({Command::RD, Command::RDA}, Command::WRA, Scope::OtherRank, tWRRD_R);
+    addConstraint({Command::RD, Command::RDA}, Command::PDXA, Scope::Rank, tXP);
+
+    // WR, WRA
+    addConstraint({Command::WR, Command::WRA}, Command::ACT, Scope::Bank, tRCD);
+    addConstraint({Command::WR, Command::WRA}, Command::RD, Scope::Rank, tRDWR);
+    addConstraint({Command::WR, Command::WRA}, Command::RD, Scope::OtherRank, tRDWR_R);
+    addConstraint({Command::WR, Command::WRA}, Command::RDA, Scope::Rank, tRDWR);
+    addConstraint({Command::WR, Command::WRA}, Command::RDA, Scope::OtherRank, tRDWR_R);
+    addConstraint({Command::WR, Command::WRA}, Command::WR, Scope::Rank, tCCD);
+    addConstraint({Command::WR, Command::WRA}, Command::WR, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::WR, Command::WRA}, Command::WRA, Scope::Rank, tCCD);
+    addConstraint({Command::WR, Command::WRA}, Command::WRA, Scope::OtherRank, tBURST + tRTRS);
+    addConstraint({Command::WR, Command::WRA}, Command::PDXA, Scope::Rank, tXP);
+
+    // ACT
+    addConstraint({Command::ACT}, Command::ACT, Scope::Bank, tRCpb);
+    addConstraint({Command::ACT}, Command::ACT, Scope::Rank, tRRD);
+    addConstraint({Command::ACT}, Command::RDA, Scope::Bank, tRDAACT);
+    addConstraint({Command::ACT}, Command::WRA, Scope::Bank, tWRAACT);
+    addConstraint({Command::ACT}, Command::PRE, Scope::Bank, tRPpb - 2);
+    addConstraint({Command::ACT}, Command::PREA, Scope::Rank, tRPab - 2);
+    addConstraint({Command::ACT}, Command::PDXA, Scope::Rank, tXP);
+    addConstraint({Command::ACT}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::ACT}, Command::REFA, Scope::Rank, tRFCab - 2);
+    addConstraint({Command::ACT}, Command::REFB, Scope::Bank, tRFCpb - 2);
+    addConstraint({Command::ACT}, Command::REFB, Scope::Rank, tRRD - 2);
+    addConstraint({Command::ACT}, Command::SREFEX, Scope::Rank, tXSR - 2);
+
+    // PRE
+    addConstraint({Command::PRE}, Command::ACT, Scope::Bank, tRAS + 2);
+    addConstraint({Command::PRE}, Command::RD, Scope::Bank, tRDPRE);
+    addConstraint({Command::PRE}, Command::WR, Scope::Bank, tWRPRE);
+    addConstraint({Command::PRE}, Command::PRE, Scope::Rank, tPPD);
+    addConstraint({Command::PRE}, Command::PDXA, Scope::Rank, tXP);
+
+    // PREA
+    addConstraint({Command::PREA}, Command::ACT, Scope::Rank, tRAS + 2);
+    addConstraint({Command::PREA}, Command::RD, Scope::Rank, tRDPRE);
+    addConstraint({Command::PREA}, Command::RDA, Scope::Rank, tRDPRE);
+    addConstraint({Command::PREA}, Command::WR, Scope::Rank, tWRPRE);
+    addConstraint({Command::PREA}, Command::WRA, Scope::Rank, tWRPRE);
+    addConstraint({Command::PREA}, Command::PRE, Scope::Rank, tPPD);
+    addConstraint({Command::PREA}, Command::PDXA, Scope::Rank, tXP);
+    addConstraint({Command::PREA}, Command::REFB, Scope::Rank, tRFCpb);
+
+    // REFA
+    addConstraint({Command::REFA}, Command::ACT, Scope::Rank, tRCpb + 2);
+    addConstraint({Command::REFA}, Command::RDA, Scope::Rank, tRDPRE + tRPpb);
+    addConstraint({Command::REFA}, Command::WRA, Scope::Rank, tWRPRE + tRPpb);
+    addConstraint({Command::REFA}, Command::PRE, Scope::Rank, tRPpb);
+    addConstraint({Command::REFA}, Command::PREA, Scope::Rank, tRPab);
+    addConstraint({Command::REFA}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::REFA}, Command::REFA, Scope::Rank, tRFCab);
+    addConstraint({Command::REFA}, Command::REFB, Scope::Rank, tRFCpb);
+    addConstraint({Command::REFA}, Command::SREFEX, Scope::Rank, tXSR);
+
+    // REFB
+    addConstraint({Command::REFB}, Command::ACT, Scope::Bank, tRCpb + 2);
+    addConstraint({Command::REFB}, Command::ACT, Scope::Rank, tRRD + 2);
+    addConstraint({Command::REFB}, Command::RDA, Scope::Bank, tRDPRE + tRPpb);
+    addConstraint({Command::REFB}, Command::WRA, Scope::Bank, tWRPRE + tRPpb);
+    addConstraint({Command::REFB}, Command::PRE, Scope::Bank, tRPpb);
+    addConstraint({Command::REFB}, Command::PREA, Scope::Rank, tRPab);
+    addConstraint({Command::REFB}, Command::PDXA, Scope::Rank, tXP);
+    addConstraint({Command::REFB}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::REFB}, Command::REFA, Scope::Rank, tRFCab);
+    addConstraint({Command::REFB}, Command::REFB, Scope::Rank, tRFCpb);
+    addConstraint({Command::REFB}, Command::SREFEX, Scope::Rank, tXSR);
+
+    // PDEA
+    addConstraint({Command::PDEA}, Command::ACT, Scope::Rank, tACTPDEN);
+    addConstraint({Command::PDEA}, Command::RD, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEA}, Command::RDA, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEA}, Command::WR, Scope::Rank, tWRPDEN);
+    addConstraint({Command::PDEA}, Command::WRA, Scope::Rank, tWRAPDEN);
+    addConstraint({Command::PDEA}, Command::PRE, Scope::Rank, tPRPDEN);
+    addConstraint({Command::PDEA}, Command::REFB, Scope::Rank, tREFPDEN);
+    addConstraint({Command::PDEA}, Command::PDXA, Scope::Rank, tCKE);
+
+    // PDXA
+    addConstraint({Command::PDXA}, Command::PDEA, Scope::Rank, tCKE);
+
+    // PDEP
+    addConstraint({Command::PDEP}, Command::RD, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEP}, Command::RDA, Scope::Rank, tRDPDEN);
+    addConstraint({Command::PDEP}, Command::WRA, Scope::Rank, tWRAPDEN);
+    addConstraint({Command::PDEP}, Command::PRE, Scope::Rank, tPRPDEN);
+    addConstraint({Command::PDEP}, Command::PREA, Scope::Rank, tPRPDEN);
+    addConstraint({Command::PDEP}, Command::REFA, Scope::Rank, tREFPDEN);
+    addConstraint({Command::PDEP}, Command::REFB, Scope::Rank, tREFPDEN);
+    addConstraint({Command::PDEP}, Command::PDXP, Scope::Rank, tCKE);
+    addConstraint({Command::PDEP}, Command::SREFEX, Scope::Rank, tXSR);
+
+    // PDXP
+    addConstraint({Command::PDXP}, Command::PDEP, Scope::Rank, tCKE);
+
+    // SREFEN
+    addConstraint({Command::SREFEN}, Command::ACT, Scope::Rank, tRCpb + 2);
+    addConstraint({Command::SREFEN}, Command::RDA, Scope::Rank, std::max(tRDPDEN, tRDPRE + tRPpb));
+    addConstraint({Command::SREFEN}, Command::WRA, Scope::Rank, std::max(tWRAPDEN, tWRPRE + tRPpb));
+    addConstraint({Command::SREFEN}, Command::PRE, Scope::Rank, tRPpb);
+    addConstraint({Command::SREFEN}, Command::PREA, Scope::Rank, tRPab);
+    addConstraint({Command::SREFEN}, Command::PDXP, Scope::Rank, tXP);
+    addConstraint({Command::SREFEN}, Command::REFA, Scope::Rank, tRFCab);
+    addConstraint({Command::SREFEN}, Command::REFB, Scope::Rank, tRFCpb);
+    addConstraint({Command::SREFEN}, Command::SREFEX, Scope::Rank, tXSR);
+
+    // SREFEX
+    addConstraint({Command::SREFEX}, Command::SREFEN, Scope::Rank, tSR);
+
+    // Activate window
+    addWindowConstraint({Command::ACT}, tFAW - 3);
+    addWindowConstraint({Command::REFB}, tFAW - 1);
+}
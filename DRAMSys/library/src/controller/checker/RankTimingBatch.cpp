@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "RankTimingBatch.h"
+#include "../../configuration/Configuration.h"
+
+RankTimingBatch::RankTimingBatch(CheckerIF *checker, Rank rank, const uint64_t &currentCycle)
+    : checker(checker), rank(rank), currentCycle(currentCycle)
+{
+    batched = checker->evaluatesRankNatively();
+    banksPerRank = Configuration::getInstance().memSpec->banksPerRank;
+    earliestTimes = std::vector<uint64_t>(numberOfCommands() * banksPerRank);
+    evaluatedCycle = std::vector<uint64_t>(numberOfCommands(), MAX_CYCLE);
+}
+
+uint64_t RankTimingBatch::timeToSatisfyConstraints(Command command, BankGroup bankgroup, Bank bank)
+{
+    if (!batched)
+        return checker->timeToSatisfyConstraints(command, rank, bankgroup, bank);
+
+    uint64_t *times = &earliestTimes[command * banksPerRank];
+    if (evaluatedCycle[command] != currentCycle)
+    {
+        checker->timeToSatisfyConstraintsOnRank(command, rank, times);
+        evaluatedCycle[command] = currentCycle;
+    }
+    return times[bank.ID() % banksPerRank];
+}
+
+void RankTimingBatch::invalidate()
+{
+    if (batched)
+        std::fill(evaluatedCycle.begin(), evaluatedCycle.end(), MAX_CYCLE);
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef RANKTIMINGBATCH_H
+#define RANKTIMINGBATCH_H
+
+#include <vector>
+#include "CheckerIF.h"
+
+// Serves the timing queries of the bank machines of one rank. With a checker that evaluates a whole
+// rank natively, the first query of a command in a cycle evaluates all banks of the rank with one
+// batched call and the other bank machines are served from its result until the next insert.
+// Scalar checkers are queried bank by bank, the results are the same in both cases.
+class RankTimingBatch
+{
+public:
+    RankTimingBatch(CheckerIF *checker, Rank rank, const uint64_t &currentCycle);
+
+    uint64_t timeToSatisfyConstraints(Command, BankGroup, Bank);
+    // Has to be called after every insert into the checker
+    void invalidate();
+
+private:
+    CheckerIF *checker;
+    Rank rank;
+    const uint64_t &currentCycle;
+    bool batched;
+    unsigned banksPerRank;
+
+    // Earliest times per [command][bank within the rank], valid if evaluatedCycle[command] is the current cycle
+    std::vector<uint64_t> earliestTimes;
+    std::vector<uint64_t> evaluatedCycle;
+};
+
+#endif // RANKTIMINGBATCH_H
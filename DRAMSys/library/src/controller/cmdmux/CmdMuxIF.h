@@ -37,16 +37,14 @@
 
 #include <systemc.h>
 #include <tlm.h>
-#include <utility>
-#include <list>
 #include "../Command.h"
 
+// The controller passes a preallocated array that only contains candidates ready for the current time
 class CmdMuxIF
 {
 public:
     virtual ~CmdMuxIF() {}
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time>
-        selectCommand(std::list<std::tuple<Command, tlm::tlm_generic_payload *, sc_time>> &) = 0;
+    virtual CommandCandidate selectCommand(const CommandCandidate *readyCommands, unsigned numberOfReadyCommands) = 0;
 };
 
 #endif // CMDMUXIF_H
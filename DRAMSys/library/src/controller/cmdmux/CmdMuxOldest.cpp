@@ -38,30 +38,24 @@
 
 using namespace tlm;
 
-std::tuple<Command, tlm_generic_payload *, sc_time>
-CmdMuxOldest::selectCommand(std::list<std::tuple<Command, tlm_generic_payload *, sc_time>> &readyCommands)
-{    
-    readyCommands.remove_if([](std::tuple<Command, tlm_generic_payload *, sc_time> element){return std::get<2>(element) != sc_time_stamp();});
-
-    if (!readyCommands.empty())
+CommandCandidate CmdMuxOldest::selectCommand(const CommandCandidate *readyCommands, unsigned numberOfReadyCommands)
+{
+    if (numberOfReadyCommands > 0)
     {
-        auto it = readyCommands.begin();
-        auto result = it;
-        uint64_t lastPayloadID = DramExtension::getPayloadID(std::get<1>(*it));
-        it++;
+        unsigned result = 0;
+        uint64_t lastPayloadID = DramExtension::getPayloadID(readyCommands[0].payload);
 
-        while (it != readyCommands.end())
+        for (unsigned i = 1; i < numberOfReadyCommands; i++)
         {
-            uint64_t newPayloadID = DramExtension::getPayloadID(std::get<1>(*it));
+            uint64_t newPayloadID = DramExtension::getPayloadID(readyCommands[i].payload);
             if (newPayloadID < lastPayloadID)
             {
                 lastPayloadID = newPayloadID;
-                result = it;
+                result = i;
             }
-            it++;
         }
-        return *result;
+        return readyCommands[result];
     }
     else
-        return std::tuple<Command, tlm_generic_payload *, sc_time>(Command::NOP, nullptr, sc_max_time());
+        return CommandCandidate{Command::NOP, nullptr, MAX_CYCLE};
 }
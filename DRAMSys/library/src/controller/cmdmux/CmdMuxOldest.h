@@ -40,8 +40,7 @@
 class CmdMuxOldest : public CmdMuxIF
 {
 public:
-    std::tuple<Command, tlm::tlm_generic_payload *, sc_time>
-        selectCommand(std::list<std::tuple<Command, tlm::tlm_generic_payload *, sc_time>> &);
+    CommandCandidate selectCommand(const CommandCandidate *readyCommands, unsigned numberOfReadyCommands);
 };
 
 #endif // CMDMUXOLDEST_H
@@ -38,29 +38,23 @@
 
 using namespace tlm;
 
-std::tuple<Command, tlm_generic_payload *, sc_time>
-CmdMuxStrict::selectCommand(std::list<std::tuple<Command, tlm_generic_payload *, sc_time>> &readyCommands)
+CommandCandidate CmdMuxStrict::selectCommand(const CommandCandidate *readyCommands, unsigned numberOfReadyCommands)
 {
-    readyCommands.remove_if([](std::tuple<Command, tlm_generic_payload *, sc_time> element){return std::get<2>(element) != sc_time_stamp();});
-
-    if (!readyCommands.empty())
+    for (unsigned i = 0; i < numberOfReadyCommands; i++)
     {
-        for (auto it : readyCommands)
+        if (isCasCommand(readyCommands[i].command))
         {
-            if (isCasCommand(std::get<0>(it)))
+            if (DramExtension::getPayloadID(readyCommands[i].payload) == nextPayloadID)
             {
-                if (DramExtension::getPayloadID(std::get<1>(it)) == nextPayloadID)
-                {
-                    nextPayloadID++;
-                    return it;
-                }
+                nextPayloadID++;
+                return readyCommands[i];
             }
         }
-        for (auto it : readyCommands)
-        {
-            if (isRasCommand(std::get<0>(it)))
-                return it;
-        }
     }
-    return std::tuple<Command, tlm_generic_payload *, sc_time>(Command::NOP, nullptr, sc_max_time());
+    for (unsigned i = 0; i < numberOfReadyCommands; i++)
+    {
+        if (isRasCommand(readyCommands[i].command))
+            return readyCommands[i];
+    }
+    return CommandCandidate{Command::NOP, nullptr, MAX_CYCLE};
 }
@@ -40,8 +40,7 @@
 class CmdMuxStrict : public CmdMuxIF
 {
 public:
-    std::tuple<Command, tlm::tlm_generic_payload *, sc_time>
-        selectCommand(std::list<std::tuple<Command, tlm::tlm_generic_payload *, sc_time>> &);
+    CommandCandidate selectCommand(const CommandCandidate *readyCommands, unsigned numberOfReadyCommands);
 
 private:
     uint64_t nextPayloadID = 0;
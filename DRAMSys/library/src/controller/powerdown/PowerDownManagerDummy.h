@@ -46,9 +46,9 @@ public:
     virtual void triggerExit() override {}
     virtual void triggerInterruption() override {}
 
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() override;
+    virtual CommandCandidate getNextCommand() override;
     virtual void updateState(Command) override {}
-    virtual sc_time start() override;
+    virtual uint64_t start() override;
 };
 
 #endif // POWERDOWNMANAGERDUMMY_H
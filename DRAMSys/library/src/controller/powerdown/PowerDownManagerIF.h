@@ -49,9 +49,9 @@ public:
     virtual void triggerExit() = 0;
     virtual void triggerInterruption() = 0;
 
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() = 0;
+    virtual CommandCandidate getNextCommand() = 0;
     virtual void updateState(Command) = 0;
-    virtual sc_time start() = 0;
+    virtual uint64_t start() = 0;
 };
 
 #endif // POWERDOWNMANAGERIF_H
@@ -69,14 +69,14 @@ void PowerDownManagerStaggered::triggerInterruption()
         exitTriggered = true;
 }
 
-std::tuple<Command, tlm_generic_payload *, sc_time> PowerDownManagerStaggered::getNextCommand()
+CommandCandidate PowerDownManagerStaggered::getNextCommand()
 {
-    return std::tuple<Command, tlm_generic_payload *, sc_time>(nextCommand, &powerDownPayload, timeToSchedule);
+    return CommandCandidate{nextCommand, &powerDownPayload, timeToSchedule};
 }
 
-sc_time PowerDownManagerStaggered::start()
+uint64_t PowerDownManagerStaggered::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
     if (exitTriggered)
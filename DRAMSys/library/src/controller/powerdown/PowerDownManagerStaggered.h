@@ -48,9 +48,9 @@ public:
     virtual void triggerExit() override;
     virtual void triggerInterruption() override;
 
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() override;
+    virtual CommandCandidate getNextCommand() override;
     virtual void updateState(Command) override;
-    virtual sc_time start() override;
+    virtual uint64_t start() override;
 
 private:
     enum class PdmState {Idle, ActivePdn, PrechargePdn, SelfRefresh, ExtraRefresh} state = PdmState::Idle;
@@ -58,7 +58,7 @@ private:
     Rank rank;
     CheckerIF *checker;
 
-    sc_time timeToSchedule = sc_max_time();
+    uint64_t timeToSchedule = MAX_CYCLE;
     Command nextCommand = Command::NOP;
 
     bool controllerIdle = true;
@@ -40,12 +40,14 @@
 using namespace tlm;
 
 RefreshManagerBankwise::RefreshManagerBankwise(std::vector<BankMachine *> &bankMachines,
-        PowerDownManagerIF *powerDownManager, Rank rank, CheckerIF *checker)
-    : bankMachinesOnRank(bankMachines), powerDownManager(powerDownManager), rank(rank), checker(checker)
+        PowerDownManagerIF *powerDownManager, Rank rank, CheckerIF *checker, const uint64_t &currentCycle)
+    : bankMachinesOnRank(bankMachines), powerDownManager(powerDownManager), rank(rank), checker(checker),
+      currentCycle(currentCycle)
 {
     Configuration &config = Configuration::getInstance();
     memSpec = config.memSpec;
-    timeForNextTrigger = memSpec->getRefreshIntervalPB();
+    refreshInterval = memSpec->timeToCycles(memSpec->getRefreshIntervalPB());
+    timeForNextTrigger = refreshInterval;
 
     refreshPayloads = std::vector<tlm_generic_payload>(memSpec->banksPerRank);
     for (unsigned bankID = 0; bankID < memSpec->banksPerRank; bankID++)
@@ -56,30 +58,43 @@ RefreshManagerBankwise::RefreshManagerBankwise(std::vector<BankMachine *> &bankM
     remainingBankMachines = allBankMachines;
     currentBankMachine = *remainingBankMachines.begin();
 
+    // The selection policy is independent of the checker, a scalar checker is queried bank by bank
+    if (config.refreshBankSelection == "EarliestReady")
+        earliestBankFirst = true;
+    else if (config.refreshBankSelection == "Sequential")
+        earliestBankFirst = false;
+    else
+        SC_REPORT_FATAL("RefreshManagerBankwise", "Selected refresh bank selection not supported!");
+    if (earliestBankFirst)
+    {
+        prechargeTimes = std::vector<uint64_t>(memSpec->banksPerRank);
+        refreshTimes = std::vector<uint64_t>(memSpec->banksPerRank);
+    }
+
     maxPostponed = config.refreshMaxPostponed * memSpec->banksPerRank;
     maxPulledin = -(config.refreshMaxPulledin * memSpec->banksPerRank);
 }
 
-std::tuple<Command, tlm_generic_payload *, sc_time> RefreshManagerBankwise::getNextCommand()
+CommandCandidate RefreshManagerBankwise::getNextCommand()
 {
-    return std::tuple<Command, tlm_generic_payload *, sc_time>
-            (nextCommand, &refreshPayloads[currentBankMachine->getBank().ID() % memSpec->banksPerRank], timeToSchedule);
+    return CommandCandidate
+            {nextCommand, &refreshPayloads[currentBankMachine->getBank().ID() % memSpec->banksPerRank], timeToSchedule};
 }
 
-sc_time RefreshManagerBankwise::start()
+uint64_t RefreshManagerBankwise::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
-    if (sc_time_stamp() >= timeForNextTrigger)
+    if (currentCycle >= timeForNextTrigger)
     {
         powerDownManager->triggerInterruption();
         if (sleeping)
             return timeToSchedule;
 
-        if (sc_time_stamp() >= timeForNextTrigger + memSpec->getRefreshIntervalPB())
+        if (currentCycle >= timeForNextTrigger + refreshInterval)
         {
-            timeForNextTrigger += memSpec->getRefreshIntervalPB();
+            timeForNextTrigger += refreshInterval;
             state = RmState::Regular;
         }
 
@@ -92,23 +107,13 @@ sc_time RefreshManagerBankwise::start()
             {
                 currentIterator = remainingBankMachines.begin();
                 currentBankMachine = *remainingBankMachines.begin();
-
-                for (auto it = remainingBankMachines.begin(); it != remainingBankMachines.end(); it++)
-                {
-                    if ((*it)->isIdle())
-                    {
-                        currentIterator = it;
-                        currentBankMachine = *it;
-                        allBanksBusy = false;
-                        break;
-                    }
-                }
+                allBanksBusy = !selectBankMachine();
             }
 
             if (allBanksBusy && !forcedRefresh)
             {
                 flexibilityCounter++;
-                timeForNextTrigger += memSpec->getRefreshIntervalPB();
+                timeForNextTrigger += refreshInterval;
                 return timeForNextTrigger;
             }
             else
@@ -133,23 +138,12 @@ sc_time RefreshManagerBankwise::start()
         }
         else // if (state == RmState::Pulledin)
         {
-            bool allBanksBusy = true;
-
-            for (auto it = remainingBankMachines.begin(); it != remainingBankMachines.end(); it++)
-            {
-                if ((*it)->isIdle())
-                {
-                    currentIterator = it;
-                    currentBankMachine = *it;
-                    allBanksBusy = false;
-                    break;
-                }
-            }
+            bool allBanksBusy = !selectBankMachine();
 
             if (allBanksBusy)
             {
                 state = RmState::Regular;
-                timeForNextTrigger += memSpec->getRefreshIntervalPB();
+                timeForNextTrigger += refreshInterval;
                 return timeForNextTrigger;
             }
             else
@@ -168,6 +162,50 @@ sc_time RefreshManagerBankwise::start()
         return timeForNextTrigger;
 }
 
+bool RefreshManagerBankwise::selectBankMachine()
+{
+    if (!earliestBankFirst)
+    {
+        // Select the first idle remaining bank
+        for (auto it = remainingBankMachines.begin(); it != remainingBankMachines.end(); it++)
+        {
+            if ((*it)->isIdle())
+            {
+                currentIterator = it;
+                currentBankMachine = *it;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Evaluate the whole rank at once and select the idle remaining bank that can be refreshed first
+    checker->timeToSatisfyConstraintsOnRank(Command::PRE, rank, prechargeTimes.data());
+    checker->timeToSatisfyConstraintsOnRank(Command::REFB, rank, refreshTimes.data());
+
+    bool idleBankFound = false;
+    uint64_t earliestTime = MAX_CYCLE;
+
+    for (auto it = remainingBankMachines.begin(); it != remainingBankMachines.end(); it++)
+    {
+        if ((*it)->isIdle())
+        {
+            unsigned bankID = (*it)->getBank().ID() % memSpec->banksPerRank;
+            uint64_t time = ((*it)->getState() == BmState::Activated) ? prechargeTimes[bankID] : refreshTimes[bankID];
+
+            if (!idleBankFound || time < earliestTime)
+            {
+                currentIterator = it;
+                currentBankMachine = *it;
+                earliestTime = time;
+                idleBankFound = true;
+            }
+        }
+    }
+
+    return idleBankFound;
+}
+
 void RefreshManagerBankwise::updateState(Command command)
 {
     switch (command)
@@ -186,13 +224,13 @@ void RefreshManagerBankwise::updateState(Command command)
         if (flexibilityCounter == maxPulledin)
         {
             state = RmState::Regular;
-            timeForNextTrigger += memSpec->getRefreshIntervalPB();
+            timeForNextTrigger += refreshInterval;
         }
         break;
     case Command::REFA:
         // Refresh command after SREFEX
         state = RmState::Regular; // TODO: check if this assignment is necessary
-        timeForNextTrigger = sc_time_stamp() + memSpec->getRefreshIntervalPB();
+        timeForNextTrigger = currentCycle + refreshInterval;
         sleeping = false;
         break;
     case Command::PDEA: case Command::PDEP:
@@ -200,7 +238,7 @@ void RefreshManagerBankwise::updateState(Command command)
         break;
     case Command::SREFEN:
         sleeping = true;
-        timeForNextTrigger = sc_max_time();
+        timeForNextTrigger = MAX_CYCLE;
         break;
     case Command::PDXA: case Command::PDXP:
         sleeping = false;
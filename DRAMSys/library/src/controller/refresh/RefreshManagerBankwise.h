@@ -46,22 +46,27 @@
 class RefreshManagerBankwise final : public RefreshManagerIF
 {
 public:
-    RefreshManagerBankwise(std::vector<BankMachine *> &, PowerDownManagerIF *, Rank, CheckerIF *);
+    RefreshManagerBankwise(std::vector<BankMachine *> &, PowerDownManagerIF *, Rank, CheckerIF *,
+            const uint64_t &currentCycle);
 
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() override;
-    virtual sc_time start() override;
+    virtual CommandCandidate getNextCommand() override;
+    virtual uint64_t start() override;
     virtual void updateState(Command) override;
 
 private:
+    bool selectBankMachine();
+
     enum class RmState {Regular, Pulledin} state = RmState::Regular;
     const MemSpec *memSpec;
     std::vector<BankMachine *> &bankMachinesOnRank;
     PowerDownManagerIF *powerDownManager;
     std::vector<tlm::tlm_generic_payload> refreshPayloads;
-    sc_time timeForNextTrigger = sc_max_time();
-    sc_time timeToSchedule = sc_max_time();
+    uint64_t refreshInterval;
+    uint64_t timeForNextTrigger = MAX_CYCLE;
+    uint64_t timeToSchedule = MAX_CYCLE;
     Rank rank;
     CheckerIF *checker;
+    const uint64_t &currentCycle;
     Command nextCommand = Command::NOP;
 
     std::list<BankMachine *> remainingBankMachines;
@@ -69,6 +74,13 @@ private:
     std::list<BankMachine *>::iterator currentIterator;
     BankMachine *currentBankMachine;
 
+    // RefreshBankSelection "EarliestReady": the idle bank that can be refreshed first is selected,
+    // "Sequential": the first idle bank in the fixed refresh order (no additional checker queries)
+    bool earliestBankFirst;
+    // Earliest issue times of PRE and REFB for all banks of the rank
+    std::vector<uint64_t> prechargeTimes;
+    std::vector<uint64_t> refreshTimes;
+
     int flexibilityCounter = 0;
     int maxPostponed = 0;
     int maxPulledin = 0;
@@ -36,12 +36,12 @@
 
 using namespace tlm;
 
-std::tuple<Command, tlm_generic_payload *, sc_time> RefreshManagerDummy::getNextCommand()
+CommandCandidate RefreshManagerDummy::getNextCommand()
 {
-    return std::tuple<Command, tlm_generic_payload *, sc_time>(Command::NOP, nullptr, sc_max_time());
+    return CommandCandidate{Command::NOP, nullptr, MAX_CYCLE};
 }
 
-sc_time RefreshManagerDummy::start()
+uint64_t RefreshManagerDummy::start()
 {
-    return sc_max_time();
+    return MAX_CYCLE;
 }
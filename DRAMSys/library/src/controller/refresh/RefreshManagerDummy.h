@@ -44,8 +44,8 @@
 class RefreshManagerDummy final : public RefreshManagerIF
 {
 public:
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() override;
-    virtual sc_time start() override;
+    virtual CommandCandidate getNextCommand() override;
+    virtual uint64_t start() override;
     virtual void updateState(Command) override {}
 };
 
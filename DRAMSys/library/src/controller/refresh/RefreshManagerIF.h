@@ -45,8 +45,8 @@ class RefreshManagerIF
 public:
     virtual ~RefreshManagerIF() {}
 
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() = 0;
-    virtual sc_time start() = 0;
+    virtual CommandCandidate getNextCommand() = 0;
+    virtual uint64_t start() = 0;
     virtual void updateState(Command) = 0;
 };
 
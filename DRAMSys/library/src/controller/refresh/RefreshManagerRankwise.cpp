@@ -40,37 +40,39 @@
 using namespace tlm;
 
 RefreshManagerRankwise::RefreshManagerRankwise(std::vector<BankMachine *> &bankMachines,
-        PowerDownManagerIF *powerDownManager, Rank rank, CheckerIF *checker)
-    : bankMachinesOnRank(bankMachines), powerDownManager(powerDownManager), rank(rank), checker(checker)
+        PowerDownManagerIF *powerDownManager, Rank rank, CheckerIF *checker, const uint64_t &currentCycle)
+    : bankMachinesOnRank(bankMachines), powerDownManager(powerDownManager), rank(rank), checker(checker),
+      currentCycle(currentCycle)
 {
     Configuration &config = Configuration::getInstance();
     memSpec = config.memSpec;
-    timeForNextTrigger = memSpec->getRefreshIntervalAB();
+    refreshInterval = memSpec->timeToCycles(memSpec->getRefreshIntervalAB());
+    timeForNextTrigger = refreshInterval;
     setUpDummy(refreshPayload, 0, rank);
 
     maxPostponed = config.refreshMaxPostponed;
     maxPulledin = -config.refreshMaxPulledin;
 }
 
-std::tuple<Command, tlm_generic_payload *, sc_time> RefreshManagerRankwise::getNextCommand()
+CommandCandidate RefreshManagerRankwise::getNextCommand()
 {
-    return std::tuple<Command, tlm_generic_payload *, sc_time>(nextCommand, &refreshPayload, timeToSchedule);
+    return CommandCandidate{nextCommand, &refreshPayload, timeToSchedule};
 }
 
-sc_time RefreshManagerRankwise::start()
+uint64_t RefreshManagerRankwise::start()
 {
-    timeToSchedule = sc_max_time();
+    timeToSchedule = MAX_CYCLE;
     nextCommand = Command::NOP;
 
-    if (sc_time_stamp() >= timeForNextTrigger)
+    if (currentCycle >= timeForNextTrigger)
     {
         powerDownManager->triggerInterruption();
         if (sleeping)
             return timeToSchedule;
 
-        if (sc_time_stamp() >= timeForNextTrigger + memSpec->getRefreshIntervalAB())
+        if (currentCycle >= timeForNextTrigger + refreshInterval)
         {
-            timeForNextTrigger += memSpec->getRefreshIntervalAB();
+            timeForNextTrigger += refreshInterval;
             state = RmState::Regular;
         }
 
@@ -96,7 +98,7 @@ sc_time RefreshManagerRankwise::start()
                 if (controllerBusy)
                 {
                     flexibilityCounter++;
-                    timeForNextTrigger += memSpec->getRefreshIntervalAB();
+                    timeForNextTrigger += refreshInterval;
                     return timeForNextTrigger;
                 }
             }
@@ -123,7 +125,7 @@ sc_time RefreshManagerRankwise::start()
             if (controllerBusy)
             {
                 state = RmState::Regular;
-                timeForNextTrigger += memSpec->getRefreshIntervalAB();
+                timeForNextTrigger += refreshInterval;
                 return timeForNextTrigger;
             }
             else
@@ -156,7 +158,7 @@ void RefreshManagerRankwise::updateState(Command command)
         {
             // Refresh command after SREFEX
             state = RmState::Regular; // TODO: check if this assignment is necessary
-            timeForNextTrigger = sc_time_stamp() + memSpec->getRefreshIntervalAB();
+            timeForNextTrigger = currentCycle + refreshInterval;
             sleeping = false;
         }
         else
@@ -169,7 +171,7 @@ void RefreshManagerRankwise::updateState(Command command)
             if (flexibilityCounter == maxPulledin)
             {
                 state = RmState::Regular;
-                timeForNextTrigger += memSpec->getRefreshIntervalAB();
+                timeForNextTrigger += refreshInterval;
             }
         }
         break;
@@ -178,7 +180,7 @@ void RefreshManagerRankwise::updateState(Command command)
         break;
     case Command::SREFEN:
         sleeping = true;
-        timeForNextTrigger = sc_max_time();
+        timeForNextTrigger = MAX_CYCLE;
         break;
     case Command::PDXA: case Command::PDXP:
         sleeping = false;
@@ -44,10 +44,11 @@
 class RefreshManagerRankwise final : public RefreshManagerIF
 {
 public:
-    RefreshManagerRankwise(std::vector<BankMachine *> &, PowerDownManagerIF *, Rank, CheckerIF *);
+    RefreshManagerRankwise(std::vector<BankMachine *> &, PowerDownManagerIF *, Rank, CheckerIF *,
+            const uint64_t &currentCycle);
 
-    virtual std::tuple<Command, tlm::tlm_generic_payload *, sc_time> getNextCommand() override;
-    virtual sc_time start() override;
+    virtual CommandCandidate getNextCommand() override;
+    virtual uint64_t start() override;
     virtual void updateState(Command) override;
 
 private:
@@ -56,10 +57,12 @@ private:
     std::vector<BankMachine *> &bankMachinesOnRank;
     PowerDownManagerIF *powerDownManager;
     tlm::tlm_generic_payload refreshPayload;
-    sc_time timeForNextTrigger = sc_max_time();
-    sc_time timeToSchedule = sc_max_time();
+    uint64_t refreshInterval;
+    uint64_t timeForNextTrigger = MAX_CYCLE;
+    uint64_t timeToSchedule = MAX_CYCLE;
     Rank rank;
     CheckerIF *checker;
+    const uint64_t &currentCycle;
     Command nextCommand = Command::NOP;
 
     unsigned activatedBanks = 0;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "BufferCounterBankwise.h"
+#include "../../configuration/Configuration.h"
+#include "../../common/dramExtensions.h"
+
+BufferCounterBankwise::BufferCounterBankwise()
+{
+    Configuration &config = Configuration::getInstance();
+    requestBufferSize = config.requestBufferSize;
+    numberOfRequests = std::vector<unsigned>(config.memSpec->numberOfBanks);
+}
+
+bool BufferCounterBankwise::hasBufferSpace(const tlm::tlm_generic_payload &payload) const
+{
+    return (numberOfRequests[DramExtension::getBank(payload).ID()] < requestBufferSize);
+}
+
+void BufferCounterBankwise::storeRequest(tlm::tlm_generic_payload *payload)
+{
+    numberOfRequests[DramExtension::getBank(payload).ID()]++;
+}
+
+void BufferCounterBankwise::removeRequest(tlm::tlm_generic_payload *payload)
+{
+    numberOfRequests[DramExtension::getBank(payload).ID()]--;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "BufferCounterShared.h"
+#include "../../configuration/Configuration.h"
+#include "../../common/dramExtensions.h"
+
+using namespace tlm;
+
+BufferCounterShared::BufferCounterShared()
+{
+    Configuration &config = Configuration::getInstance();
+    totalSize = config.requestBufferSize;
+    bankSize = config.requestBufferSizeBank;
+    rankSize = config.requestBufferSizeRank;
+    readSize = config.requestBufferSizeRead;
+    writeSize = config.requestBufferSizeWrite;
+
+    requestsPerBank = std::vector<unsigned>(config.memSpec->numberOfBanks);
+    requestsPerRank = std::vector<unsigned>(config.memSpec->numberOfRanks);
+}
+
+bool BufferCounterShared::hasBufferSpace(const tlm_generic_payload &payload) const
+{
+    if (numberOfRequests >= totalSize)
+        return false;
+    if (bankSize != 0 && requestsPerBank[DramExtension::getBank(payload).ID()] >= bankSize)
+        return false;
+    if (rankSize != 0 && requestsPerRank[DramExtension::getRank(payload).ID()] >= rankSize)
+        return false;
+    if (readSize != 0 && payload.get_command() == TLM_READ_COMMAND && numberOfReads >= readSize)
+        return false;
+    if (writeSize != 0 && payload.get_command() == TLM_WRITE_COMMAND && numberOfWrites >= writeSize)
+        return false;
+    return true;
+}
+
+void BufferCounterShared::storeRequest(tlm_generic_payload *payload)
+{
+    numberOfRequests++;
+    requestsPerBank[DramExtension::getBank(payload).ID()]++;
+    requestsPerRank[DramExtension::getRank(payload).ID()]++;
+    if (payload->get_command() == TLM_READ_COMMAND)
+        numberOfReads++;
+    else if (payload->get_command() == TLM_WRITE_COMMAND)
+        numberOfWrites++;
+}
+
+void BufferCounterShared::removeRequest(tlm_generic_payload *payload)
+{
+    numberOfRequests--;
+    requestsPerBank[DramExtension::getBank(payload).ID()]--;
+    requestsPerRank[DramExtension::getRank(payload).ID()]--;
+    if (payload->get_command() == TLM_READ_COMMAND)
+        numberOfReads--;
+    else if (payload->get_command() == TLM_WRITE_COMMAND)
+        numberOfWrites--;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "RequestBuffer.h"
+#include "../../configuration/Configuration.h"
+
+using namespace tlm;
+
+RequestBuffer::RequestBuffer()
+{
+    Configuration &config = Configuration::getInstance();
+    unsigned numberOfBanks = config.memSpec->numberOfBanks;
+    unsigned capacity = (config.requestBufferPolicy == "Shared") ?
+            config.requestBufferSize : numberOfBanks * config.requestBufferSize;
+
+    banks = std::vector<BankQueue>(numberOfBanks);
+    entries = std::vector<Entry>(capacity);
+    freeEntries.reserve(capacity);
+    for (unsigned entryID = capacity; entryID > 0; entryID--)
+        freeEntries.push_back(entryID - 1);
+    entryOfPayload.reserve(capacity);
+    requestsPerAddress.reserve(capacity);
+}
+
+void RequestBuffer::storeRequest(tlm_generic_payload *payload, uint64_t arrivalCycle)
+{
+    if (freeEntries.empty())
+    {
+        freeEntries.push_back(entries.size());
+        entries.push_back(Entry());
+    }
+    unsigned entryID = freeEntries.back();
+    freeEntries.pop_back();
+
+    Entry &entry = entries[entryID];
+    entry.payload = payload;
+    entry.address = payload->get_address();
+    entry.sequenceNumber = nextSequenceNumber++;
+    entry.arrivalCycle = arrivalCycle;
+    entry.bankID = DramExtension::getBank(payload).ID();
+    entry.rowID = DramExtension::getRow(payload).ID();
+    entry.commandID = commandToID(payload->get_command());
+
+    BankQueue &bankQueue = banks[entry.bankID];
+    entry.previousInBank = bankQueue.last;
+    entry.nextInBank = NO_ENTRY;
+    if (bankQueue.last == NO_ENTRY)
+        bankQueue.first = entryID;
+    else
+        entries[bankQueue.last].nextInBank = entryID;
+    bankQueue.last = entryID;
+    bankQueue.count++;
+
+    RowQueue &rowQueue = bankQueue.rows[entry.rowID];
+    entry.previousInRow = rowQueue.last[entry.commandID];
+    entry.nextInRow = NO_ENTRY;
+    if (rowQueue.last[entry.commandID] == NO_ENTRY)
+        rowQueue.first[entry.commandID] = entryID;
+    else
+        entries[rowQueue.last[entry.commandID]].nextInRow = entryID;
+    rowQueue.last[entry.commandID] = entryID;
+    rowQueue.count++;
+
+    entryOfPayload[payload] = entryID;
+    requestsPerAddress[entry.address]++;
+}
+
+void RequestBuffer::removeRequest(tlm_generic_payload *payload)
+{
+    auto payloadIt = entryOfPayload.find(payload);
+    if (payloadIt == entryOfPayload.end())
+        SC_REPORT_FATAL("RequestBuffer", "removeRequest failed!");
+    unsigned entryID = payloadIt->second;
+    entryOfPayload.erase(payloadIt);
+
+    Entry &entry = entries[entryID];
+
+    BankQueue &bankQueue = banks[entry.bankID];
+    if (entry.previousInBank == NO_ENTRY)
+        bankQueue.first = entry.nextInBank;
+    else
+        entries[entry.previousInBank].nextInBank = entry.nextInBank;
+    if (entry.nextInBank == NO_ENTRY)
+        bankQueue.last = entry.previousInBank;
+    else
+        entries[entry.nextInBank].previousInBank = entry.previousInBank;
+    bankQueue.count--;
+
+    auto rowIt = bankQueue.rows.find(entry.rowID);
+    RowQueue &rowQueue = rowIt->second;
+    if (entry.previousInRow == NO_ENTRY)
+        rowQueue.first[entry.commandID] = entry.nextInRow;
+    else
+        entries[entry.previousInRow].nextInRow = entry.nextInRow;
+    if (entry.nextInRow == NO_ENTRY)
+        rowQueue.last[entry.commandID] = entry.previousInRow;
+    else
+        entries[entry.nextInRow].previousInRow = entry.previousInRow;
+    rowQueue.count--;
+    if (rowQueue.count == 0)
+        bankQueue.rows.erase(rowIt);
+
+    auto addressIt = requestsPerAddress.find(entry.address);
+    addressIt->second--;
+    if (addressIt->second == 0)
+        requestsPerAddress.erase(addressIt);
+
+    freeEntries.push_back(entryID);
+}
+
+uint64_t RequestBuffer::getArrivalCycle(tlm_generic_payload *payload) const
+{
+    auto payloadIt = entryOfPayload.find(payload);
+    if (payloadIt == entryOfPayload.end())
+        SC_REPORT_FATAL("RequestBuffer", "getArrivalCycle failed!");
+    return entries[payloadIt->second].arrivalCycle;
+}
+
+unsigned RequestBuffer::getNumberOfRequests(Bank bank) const
+{
+    return banks[bank.ID()].count;
+}
+
+unsigned RequestBuffer::getNumberOfRowHits(Bank bank, Row row) const
+{
+    auto rowIt = banks[bank.ID()].rows.find(row.ID());
+    if (rowIt == banks[bank.ID()].rows.end())
+        return 0;
+    else
+        return rowIt->second.count;
+}
+
+tlm_generic_payload *RequestBuffer::getOldestRequest(Bank bank) const
+{
+    unsigned entryID = banks[bank.ID()].first;
+    if (entryID == NO_ENTRY)
+        return nullptr;
+    else
+        return entries[entryID].payload;
+}
+
+tlm_generic_payload *RequestBuffer::getOldestRowHit(Bank bank, Row row) const
+{
+    auto rowIt = banks[bank.ID()].rows.find(row.ID());
+    if (rowIt == banks[bank.ID()].rows.end())
+        return nullptr;
+
+    // The oldest row hit is the older one of the oldest read and the oldest write
+    unsigned readID = rowIt->second.first[0];
+    unsigned writeID = rowIt->second.first[1];
+    if (readID == NO_ENTRY)
+        return entries[writeID].payload;
+    else if (writeID == NO_ENTRY)
+        return entries[readID].payload;
+    else if (entries[readID].sequenceNumber < entries[writeID].sequenceNumber)
+        return entries[readID].payload;
+    else
+        return entries[writeID].payload;
+}
+
+tlm_generic_payload *RequestBuffer::getOldestRowHitWithoutHazard(Bank bank, Row row, tlm_command command) const
+{
+    auto rowIt = banks[bank.ID()].rows.find(row.ID());
+    if (rowIt == banks[bank.ID()].rows.end())
+        return nullptr;
+
+    for (unsigned entryID = rowIt->second.first[commandToID(command)]; entryID != NO_ENTRY;
+         entryID = entries[entryID].nextInRow)
+    {
+        if (!hasHazard(entryID))
+            return entries[entryID].payload;
+    }
+    return nullptr;
+}
+
+bool RequestBuffer::hasHazard(unsigned entryID) const
+{
+    const Entry &entry = entries[entryID];
+
+    // Only requests with a shared address have to be searched for an older one
+    if (requestsPerAddress.find(entry.address)->second == 1)
+        return false;
+
+    for (unsigned otherID = banks[entry.bankID].first; otherID != entryID; otherID = entries[otherID].nextInBank)
+    {
+        if (entries[otherID].address == entry.address)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef REQUESTBUFFER_H
+#define REQUESTBUFFER_H
+
+#include <tlm.h>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "../../common/dramExtensions.h"
+
+// Request buffer of the FR-FCFS schedulers indexed by bank and row: row hit lookups, row hit counts
+// and removals are constant time, the bank, row and address of each request are cached on insertion
+class RequestBuffer
+{
+public:
+    RequestBuffer();
+    void storeRequest(tlm::tlm_generic_payload *, uint64_t arrivalCycle = 0);
+    void removeRequest(tlm::tlm_generic_payload *);
+    uint64_t getArrivalCycle(tlm::tlm_generic_payload *) const;
+
+    unsigned getNumberOfRequests(Bank) const;
+    unsigned getNumberOfRowHits(Bank, Row) const;
+    tlm::tlm_generic_payload *getOldestRequest(Bank) const;
+    tlm::tlm_generic_payload *getOldestRowHit(Bank, Row) const;
+    // Oldest row hit with the given command that is not preceded by a request to the same address
+    tlm::tlm_generic_payload *getOldestRowHitWithoutHazard(Bank, Row, tlm::tlm_command) const;
+
+    // Calls function(payload, row) for the requests of the bank from oldest to youngest until it returns false
+    template <typename Function>
+    void forEachRequest(Bank bank, Function function) const
+    {
+        for (unsigned entryID = banks[bank.ID()].first; entryID != NO_ENTRY; entryID = entries[entryID].nextInBank)
+        {
+            if (!function(entries[entryID].payload, Row(entries[entryID].rowID)))
+                return;
+        }
+    }
+
+private:
+    static constexpr unsigned NO_ENTRY = UINT32_MAX;
+
+    struct Entry
+    {
+        tlm::tlm_generic_payload *payload;
+        uint64_t address;
+        uint64_t sequenceNumber;
+        uint64_t arrivalCycle;
+        unsigned bankID;
+        unsigned rowID;
+        unsigned commandID;
+        // Intrusive links of the bank FIFO and of the per-command FIFO of the row
+        unsigned previousInBank;
+        unsigned nextInBank;
+        unsigned previousInRow;
+        unsigned nextInRow;
+    };
+
+    struct RowQueue
+    {
+        unsigned first[2] = {NO_ENTRY, NO_ENTRY};
+        unsigned last[2] = {NO_ENTRY, NO_ENTRY};
+        unsigned count = 0;
+    };
+
+    struct BankQueue
+    {
+        unsigned first = NO_ENTRY;
+        unsigned last = NO_ENTRY;
+        unsigned count = 0;
+        std::unordered_map<unsigned, RowQueue> rows;
+    };
+
+    static unsigned commandToID(tlm::tlm_command command) { return (command == tlm::TLM_WRITE_COMMAND) ? 1 : 0; }
+    bool hasHazard(unsigned entryID) const;
+
+    std::vector<Entry> entries;
+    std::vector<unsigned> freeEntries;
+    std::vector<BankQueue> banks;
+    std::unordered_map<tlm::tlm_generic_payload *, unsigned> entryOfPayload;
+    std::unordered_map<uint64_t, unsigned> requestsPerAddress;
+    uint64_t nextSequenceNumber = 0;
+};
+
+#endif // REQUESTBUFFER_H
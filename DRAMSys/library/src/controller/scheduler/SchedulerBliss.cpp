@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "SchedulerBliss.h"
+#include "../../configuration/Configuration.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace tlm;
+
+SchedulerBliss::SchedulerBliss(const uint64_t &currentCycle) : currentCycle(currentCycle)
+{
+    Configuration &config = Configuration::getInstance();
+    threshold = config.blissThreshold;
+    clearingInterval = config.blissClearingInterval;
+    if (clearingInterval == 0)
+        SC_REPORT_FATAL("SchedulerBliss", "BlissClearingInterval must be greater than 0!");
+    nextClearing = clearingInterval;
+}
+
+void SchedulerBliss::storeRequest(tlm_generic_payload *payload)
+{
+    buffer.storeRequest(payload, currentCycle);
+}
+
+void SchedulerBliss::removeRequest(tlm_generic_payload *payload)
+{
+    unsigned threadID = DramExtension::getThread(payload).ID();
+    uint64_t latency = currentCycle - buffer.getArrivalCycle(payload);
+    ThreadStatistics &statistics = threadStatistics[threadID];
+    statistics.servedRequests++;
+    statistics.totalLatency += latency;
+    statistics.maxLatency = std::max(statistics.maxLatency, latency);
+
+    // Blacklist threads that are served too often in a row
+    updateBlacklist();
+    if (threadID == lastThreadID)
+        servedInRow++;
+    else
+    {
+        lastThreadID = threadID;
+        servedInRow = 1;
+    }
+    if (servedInRow > threshold)
+    {
+        if (lastThreadID >= blacklist.size())
+            blacklist.resize(lastThreadID + 1, false);
+        blacklist[lastThreadID] = true;
+        servedInRow = 0;
+    }
+
+    buffer.removeRequest(payload);
+}
+
+void SchedulerBliss::updateBlacklist()
+{
+    if (currentCycle >= nextClearing)
+    {
+        blacklist.assign(blacklist.size(), false);
+        nextClearing = currentCycle - (currentCycle % clearingInterval) + clearingInterval;
+    }
+}
+
+bool SchedulerBliss::isBlacklisted(unsigned threadID)
+{
+    return (threadID < blacklist.size() && blacklist[threadID]);
+}
+
+tlm_generic_payload *SchedulerBliss::getNextRequest(BankMachine *bankMachine)
+{
+    Bank bank = bankMachine->getBank();
+    if (buffer.getNumberOfRequests(bank) == 0)
+        return nullptr;
+
+    updateBlacklist();
+
+    // Priority: 1. request of a non-blacklisted thread, 2. row hit, 3. oldest request
+    bool activated = (bankMachine->getState() == BmState::Activated);
+    Row openRow = bankMachine->getOpenRow();
+    tlm_generic_payload *selected = nullptr;
+    unsigned selectedPriority = 0;
+
+    buffer.forEachRequest(bank, [&](tlm_generic_payload *payload, Row row)
+    {
+        unsigned priority = 1;
+        if (!isBlacklisted(DramExtension::getThread(payload).ID()))
+            priority += 2;
+        if (activated && row == openRow)
+            priority += 1;
+
+        if (priority > selectedPriority)
+        {
+            selected = payload;
+            selectedPriority = priority;
+        }
+        return priority != 4;
+    });
+    return selected;
+}
+
+bool SchedulerBliss::hasFurtherRowHit(Bank bank, Row row)
+{
+    if (buffer.getNumberOfRowHits(bank, row) >= 2)
+        return true;
+    else
+        return false;
+}
+
+bool SchedulerBliss::hasFurtherRequest(Bank bank)
+{
+    if (buffer.getNumberOfRequests(bank) >= 2)
+        return true;
+    else
+        return false;
+}
+
+void SchedulerBliss::printStatistics(const std::string &name) const
+{
+    // The slowdown of a thread is given relative to the thread with the lowest average latency
+    double lowestAverageLatency = 0.0;
+    for (auto &it : threadStatistics)
+    {
+        double averageLatency = static_cast<double>(it.second.totalLatency) / it.second.servedRequests;
+        if (lowestAverageLatency == 0.0 || averageLatency < lowestAverageLatency)
+            lowestAverageLatency = averageLatency;
+    }
+
+    for (auto &it : threadStatistics)
+    {
+        double averageLatency = static_cast<double>(it.second.totalLatency) / it.second.servedRequests;
+        std::cout << name << std::string("  Thread ") << it.first
+                  << std::string(": requests: ") << it.second.servedRequests
+                  << std::fixed << std::setprecision(2)
+                  << std::string(", average latency: ") << averageLatency
+                  << std::string(" cycles, max latency: ") << it.second.maxLatency
+                  << std::string(" cycles, slowdown: ")
+                  << ((lowestAverageLatency > 0.0) ? averageLatency / lowestAverageLatency : 1.0) << std::endl;
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef SCHEDULERBLISS_H
+#define SCHEDULERBLISS_H
+
+#include <tlm.h>
+#include <vector>
+#include <map>
+#include "SchedulerIF.h"
+#include "RequestBuffer.h"
+#include "../../common/dramExtensions.h"
+#include "../BankMachine.h"
+
+// Blacklisting scheduler (BLISS): threads that were served BlissThreshold times in a row are blacklisted
+// until the next clearing interval, requests of other threads are preferred over row hits and age
+class SchedulerBliss : public SchedulerIF
+{
+public:
+    SchedulerBliss(const uint64_t &currentCycle);
+    virtual void storeRequest(tlm::tlm_generic_payload *) override;
+    virtual void removeRequest(tlm::tlm_generic_payload *) override;
+    virtual tlm::tlm_generic_payload *getNextRequest(BankMachine *) override;
+    virtual bool hasFurtherRowHit(Bank, Row) override;
+    virtual bool hasFurtherRequest(Bank) override;
+    virtual void printStatistics(const std::string &) const override;
+
+private:
+    struct ThreadStatistics
+    {
+        uint64_t servedRequests = 0;
+        uint64_t totalLatency = 0;
+        uint64_t maxLatency = 0;
+    };
+
+    bool isBlacklisted(unsigned threadID);
+    void updateBlacklist();
+
+    const uint64_t &currentCycle;
+    RequestBuffer buffer;
+
+    unsigned threshold;
+    uint64_t clearingInterval;
+    uint64_t nextClearing;
+    std::vector<bool> blacklist;
+    unsigned lastThreadID = UINT_MAX;
+    unsigned servedInRow = 0;
+
+    std::map<unsigned, ThreadStatistics> threadStatistics;
+};
+
+#endif // SCHEDULERBLISS_H
@@ -40,21 +40,11 @@ SchedulerFifo::SchedulerFifo()
 {
     buffer = std::vector<std::deque<tlm_generic_payload *>>
             (Configuration::getInstance().memSpec->numberOfBanks);
-    requestBufferSize = Configuration::getInstance().requestBufferSize;
-}
-
-bool SchedulerFifo::hasBufferSpace()
-{
-    if (buffer[lastBankID].size() < requestBufferSize)
-        return true;
-    else
-        return false;
 }
 
 void SchedulerFifo::storeRequest(tlm_generic_payload *payload)
 {
-    lastBankID = DramExtension::getBank(payload).ID();
-    buffer[lastBankID].push_back(payload);
+    buffer[DramExtension::getBank(payload).ID()].push_back(payload);
 }
 
 void SchedulerFifo::removeRequest(tlm_generic_payload *payload)
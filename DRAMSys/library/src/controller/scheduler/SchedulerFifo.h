@@ -46,7 +46,6 @@ class SchedulerFifo : public SchedulerIF
 {
 public:
     SchedulerFifo();
-    virtual bool hasBufferSpace() override;
     virtual void storeRequest(tlm::tlm_generic_payload *) override;
     virtual void removeRequest(tlm::tlm_generic_payload *) override;
     virtual tlm::tlm_generic_payload *getNextRequest(BankMachine *) override;
@@ -54,8 +53,6 @@ public:
     virtual bool hasFurtherRequest(Bank) override;
 private:
     std::vector<std::deque<tlm::tlm_generic_payload *>> buffer;
-    unsigned requestBufferSize;
-    unsigned lastBankID;
 };
 
 #endif // SCHEDULERFIFO_H
@@ -40,78 +40,43 @@ using namespace tlm;
 
 SchedulerFrFcfs::SchedulerFrFcfs()
 {
-    buffer = std::vector<std::list<tlm_generic_payload *>>
-            (Configuration::getInstance().memSpec->numberOfBanks);
-    requestBufferSize = Configuration::getInstance().requestBufferSize;
-}
-
-bool SchedulerFrFcfs::hasBufferSpace()
-{
-    if (buffer[lastBankID].size() < requestBufferSize)
-        return true;
-    else
-        return false;
 }
 
 void SchedulerFrFcfs::storeRequest(tlm_generic_payload *payload)
 {
-    lastBankID = DramExtension::getBank(payload).ID();
-    buffer[lastBankID].push_back(payload);
+    buffer.storeRequest(payload);
 }
 
 void SchedulerFrFcfs::removeRequest(tlm_generic_payload *payload)
 {
-    unsigned bankID = DramExtension::getBank(payload).ID();
-    for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
-    {
-        if (*it == payload)
-        {
-            buffer[bankID].erase(it);
-            return;
-        }
-    }
-    SC_REPORT_FATAL("SchedulerFrFcfs", "removeRequest failed!");
+    buffer.removeRequest(payload);
 }
 
 tlm_generic_payload *SchedulerFrFcfs::getNextRequest(BankMachine *bankMachine)
 {
-    unsigned bankID = bankMachine->getBank().ID();
-    if (!buffer[bankID].empty())
+    Bank bank = bankMachine->getBank();
+    if (bankMachine->getState() == BmState::Activated)
     {
-        if (bankMachine->getState() == BmState::Activated)
-        {
-            // Search for row hit
-            Row openRow = bankMachine->getOpenRow();
-            for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
-            {
-                if (DramExtension::getRow(*it) == openRow)
-                    return *it;
-            }
-        }
-        // No row hit found or bank precharged
-        return buffer[bankID].front();
+        // Search for row hit
+        tlm_generic_payload *rowHit = buffer.getOldestRowHit(bank, bankMachine->getOpenRow());
+        if (rowHit != nullptr)
+            return rowHit;
     }
-    return nullptr;
+    // No row hit found or bank precharged
+    return buffer.getOldestRequest(bank);
 }
 
 bool SchedulerFrFcfs::hasFurtherRowHit(Bank bank, Row row)
 {
-    unsigned rowHitCounter = 0;
-    for (auto it = buffer[bank.ID()].begin(); it != buffer[bank.ID()].end(); it++)
-    {
-        if (DramExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
-    return false;
+    if (buffer.getNumberOfRowHits(bank, row) >= 2)
+        return true;
+    else
+        return false;
 }
 
 bool SchedulerFrFcfs::hasFurtherRequest(Bank bank)
 {
-    if (buffer[bank.ID()].size() >= 2)
+    if (buffer.getNumberOfRequests(bank) >= 2)
         return true;
     else
         return false;
@@ -37,8 +37,8 @@
 
 #include <tlm.h>
 #include <vector>
-#include <list>
 #include "SchedulerIF.h"
+#include "RequestBuffer.h"
 #include "../../common/dramExtensions.h"
 #include "../BankMachine.h"
 
@@ -46,16 +46,13 @@ class SchedulerFrFcfs : public SchedulerIF
 {
 public:
     SchedulerFrFcfs();
-    virtual bool hasBufferSpace() override;
     virtual void storeRequest(tlm::tlm_generic_payload *) override;
     virtual void removeRequest(tlm::tlm_generic_payload *) override;
     virtual tlm::tlm_generic_payload *getNextRequest(BankMachine *) override;
     virtual bool hasFurtherRowHit(Bank, Row) override;
     virtual bool hasFurtherRequest(Bank) override;
 private:
-    std::vector<std::list<tlm::tlm_generic_payload *>> buffer;
-    unsigned requestBufferSize;
-    unsigned lastBankID;
+    RequestBuffer buffer;
 };
 
 #endif // SCHEDULERFRFCFS_H
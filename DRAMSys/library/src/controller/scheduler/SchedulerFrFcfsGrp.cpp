@@ -38,103 +38,50 @@ using namespace tlm;
 
 SchedulerFrFcfsGrp::SchedulerFrFcfsGrp()
 {
-    buffer = std::vector<std::list<tlm_generic_payload *>>
-            (Configuration::getInstance().memSpec->numberOfBanks);
-    requestBufferSize = Configuration::getInstance().requestBufferSize;
-}
-
-bool SchedulerFrFcfsGrp::hasBufferSpace()
-{
-    if (buffer[lastBankID].size() < requestBufferSize)
-        return true;
-    else
-        return false;
 }
 
 void SchedulerFrFcfsGrp::storeRequest(tlm_generic_payload *payload)
 {
-    lastBankID = DramExtension::getBank(payload).ID();
-    buffer[lastBankID].push_back(payload);
+    buffer.storeRequest(payload);
 }
 
 void SchedulerFrFcfsGrp::removeRequest(tlm_generic_payload *payload)
 {
     lastCommand = payload->get_command();
-    unsigned bankID = DramExtension::getBank(payload).ID();
-    for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
-    {
-        if (*it == payload)
-        {
-            buffer[bankID].erase(it);
-            return;
-        }
-    }
-    SC_REPORT_FATAL("SchedulerFrFcfs", "removeRequest failed!");
+    buffer.removeRequest(payload);
 }
 
 tlm_generic_payload *SchedulerFrFcfsGrp::getNextRequest(BankMachine *bankMachine)
 {
-    unsigned bankID = bankMachine->getBank().ID();
-    if (!buffer[bankID].empty())
+    Bank bank = bankMachine->getBank();
+    if (bankMachine->getState() == BmState::Activated)
     {
-        if (bankMachine->getState() == BmState::Activated)
-        {
-            // Filter all row hits
-            Row openRow = bankMachine->getOpenRow();
-            std::list<tlm_generic_payload *> rowHits;
-            for (auto it = buffer[bankID].begin(); it != buffer[bankID].end(); it++)
-            {
-                if (DramExtension::getRow(*it) == openRow)
-                    rowHits.push_back(*it);
-            }
+        // Search for a row hit of the same type as the last request that does not overtake a request to the same address
+        Row openRow = bankMachine->getOpenRow();
+        tlm_generic_payload *rowHit = buffer.getOldestRowHitWithoutHazard(bank, openRow, lastCommand);
+        if (rowHit != nullptr)
+            return rowHit;
 
-            if (!rowHits.empty())
-            {
-                for (auto outerIt = rowHits.begin(); outerIt != rowHits.end(); outerIt++)
-                {
-                    if ((*outerIt)->get_command() == lastCommand)
-                    {
-                        bool hazardDetected = false;
-                        for (auto innerIt = rowHits.begin(); *innerIt != *outerIt; innerIt++)
-                        {
-                            if ((*outerIt)->get_address() == (*innerIt)->get_address())
-                            {
-                                hazardDetected = true;
-                                break;
-                            }
-                        }
-                        if (!hazardDetected)
-                            return *outerIt;
-                    }
-                }
-                // no rd/wr hit found -> take first row hit
-                return *rowHits.begin();
-            }
-        }
-        // No row hit found or bank precharged
-        return buffer[bankID].front();
+        // no rd/wr hit found -> take first row hit
+        rowHit = buffer.getOldestRowHit(bank, openRow);
+        if (rowHit != nullptr)
+            return rowHit;
     }
-    return nullptr;
+    // No row hit found or bank precharged
+    return buffer.getOldestRequest(bank);
 }
 
 bool SchedulerFrFcfsGrp::hasFurtherRowHit(Bank bank, Row row)
 {
-    unsigned rowHitCounter = 0;
-    for (auto it = buffer[bank.ID()].begin(); it != buffer[bank.ID()].end(); it++)
-    {
-        if (DramExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
-    return false;
+    if (buffer.getNumberOfRowHits(bank, row) >= 2)
+        return true;
+    else
+        return false;
 }
 
 bool SchedulerFrFcfsGrp::hasFurtherRequest(Bank bank)
 {
-    if (buffer[bank.ID()].size() >= 2)
+    if (buffer.getNumberOfRequests(bank) >= 2)
         return true;
     else
         return false;
@@ -37,9 +37,9 @@
 
 #include <tlm.h>
 #include <vector>
-#include <list>
 
 #include "SchedulerIF.h"
+#include "RequestBuffer.h"
 #include "../../common/dramExtensions.h"
 #include "../BankMachine.h"
 
@@ -47,17 +47,14 @@ class SchedulerFrFcfsGrp : public SchedulerIF
 {
 public:
     SchedulerFrFcfsGrp();
-    virtual bool hasBufferSpace() override;
     virtual void storeRequest(tlm::tlm_generic_payload *) override;
     virtual void removeRequest(tlm::tlm_generic_payload *) override;
     virtual tlm::tlm_generic_payload *getNextRequest(BankMachine *) override;
     virtual bool hasFurtherRowHit(Bank, Row) override;
     virtual bool hasFurtherRequest(Bank) override;
 private:
-    std::vector<std::list<tlm::tlm_generic_payload *>> buffer;
-    unsigned requestBufferSize;
+    RequestBuffer buffer;
     tlm::tlm_command lastCommand = tlm::TLM_READ_COMMAND;
-    unsigned lastBankID;
 };
 
 #endif // SCHEDULERFRFCFSGRP_H
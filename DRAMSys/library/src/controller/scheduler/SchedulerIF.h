@@ -47,12 +47,19 @@ class SchedulerIF
 {
 public:
     virtual ~SchedulerIF() {}
-    virtual bool hasBufferSpace() = 0;
     virtual void storeRequest(tlm::tlm_generic_payload *) = 0;
     virtual void removeRequest(tlm::tlm_generic_payload *) = 0;
     virtual tlm::tlm_generic_payload *getNextRequest(BankMachine *) = 0;
     virtual bool hasFurtherRowHit(Bank, Row) = 0;
     virtual bool hasFurtherRequest(Bank) = 0;
+
+    // Pending write whose data can be returned for the given read without a DRAM access
+    virtual tlm::tlm_generic_payload *getForwardingWrite(tlm::tlm_generic_payload *) { return nullptr; }
+    // True if the scheduler switched the type of requests it serves since the last call,
+    // bank machines that were idle may have a request again then
+    virtual bool hasPriorityChanged() { return false; }
+    // Prints scheduler specific statistics at the end of the simulation
+    virtual void printStatistics(const std::string &) const {}
 };
 
 #endif // SCHEDULERIF_H
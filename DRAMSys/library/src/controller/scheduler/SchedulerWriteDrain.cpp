@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "SchedulerWriteDrain.h"
+#include "../../configuration/Configuration.h"
+#include <iostream>
+
+using namespace tlm;
+
+SchedulerWriteDrain::SchedulerWriteDrain()
+{
+    Configuration &config = Configuration::getInstance();
+    highWatermark = config.writeDrainHighWatermark;
+    lowWatermark = config.writeDrainLowWatermark;
+    if (lowWatermark >= highWatermark)
+        SC_REPORT_FATAL("SchedulerWriteDrain", "Low watermark must be smaller than high watermark!");
+}
+
+void SchedulerWriteDrain::storeRequest(tlm_generic_payload *payload)
+{
+    if (payload->get_command() == TLM_WRITE_COMMAND)
+    {
+        writeBuffer.storeRequest(payload);
+        pendingWrites.emplace(payload->get_address(), payload);
+        numberOfWrites++;
+    }
+    else
+    {
+        readBuffer.storeRequest(payload);
+        pendingReads.emplace(payload->get_address(), payload);
+        numberOfReads++;
+    }
+    updateMode();
+}
+
+void SchedulerWriteDrain::removeRequest(tlm_generic_payload *payload)
+{
+    if (payload->get_command() == TLM_WRITE_COMMAND)
+    {
+        writeBuffer.removeRequest(payload);
+        removeFromMap(pendingWrites, payload);
+        numberOfWrites--;
+    }
+    else
+    {
+        readBuffer.removeRequest(payload);
+        removeFromMap(pendingReads, payload);
+        numberOfReads--;
+    }
+
+    if (lastCommand != TLM_IGNORE_COMMAND && lastCommand != payload->get_command())
+        numberOfTurnarounds++;
+    lastCommand = payload->get_command();
+
+    updateMode();
+}
+
+void SchedulerWriteDrain::removeFromMap(std::unordered_multimap<uint64_t, tlm_generic_payload *> &map,
+                                        tlm_generic_payload *payload)
+{
+    auto range = map.equal_range(payload->get_address());
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second == payload)
+        {
+            map.erase(it);
+            break;
+        }
+    }
+}
+
+void SchedulerWriteDrain::updateMode()
+{
+    if (!drainWrites && (numberOfWrites >= highWatermark || (numberOfReads == 0 && numberOfWrites > 0)))
+    {
+        drainWrites = true;
+        modeChanged = true;
+    }
+    else if (drainWrites && (numberOfWrites == 0 || (numberOfWrites <= lowWatermark && numberOfReads > 0)))
+    {
+        drainWrites = false;
+        modeChanged = true;
+    }
+}
+
+tlm_generic_payload *SchedulerWriteDrain::getNextRequest(BankMachine *bankMachine)
+{
+    RequestBuffer &buffer = drainWrites ? writeBuffer : readBuffer;
+    Bank bank = bankMachine->getBank();
+    tlm_generic_payload *request = nullptr;
+
+    if (bankMachine->getState() == BmState::Activated)
+    {
+        // Search for row hit
+        request = buffer.getOldestRowHit(bank, bankMachine->getOpenRow());
+    }
+    if (request == nullptr)
+    {
+        // No row hit found or bank precharged
+        request = buffer.getOldestRequest(bank);
+    }
+
+    // The request is stalled until all older requests to the same address (and therefore the same bank)
+    // are served, i.e., a write does not overtake an older read and a read does not overtake an older write
+    // that could not forward its data
+    if (request != nullptr)
+        request = getOldestRequest(request->get_address());
+    return request;
+}
+
+tlm_generic_payload *SchedulerWriteDrain::getOldestRequest(uint64_t address)
+{
+    tlm_generic_payload *oldest = nullptr;
+    for (auto map : {&pendingReads, &pendingWrites})
+    {
+        auto range = map->equal_range(address);
+        for (auto it = range.first; it != range.second; it++)
+        {
+            // Payload IDs are assigned in arrival order per channel
+            if (oldest == nullptr || DramExtension::getPayloadID(it->second) < DramExtension::getPayloadID(oldest))
+                oldest = it->second;
+        }
+    }
+    return oldest;
+}
+
+bool SchedulerWriteDrain::hasFurtherRowHit(Bank bank, Row row)
+{
+    RequestBuffer &buffer = drainWrites ? writeBuffer : readBuffer;
+    if (buffer.getNumberOfRowHits(bank, row) >= 2)
+        return true;
+    else
+        return false;
+}
+
+bool SchedulerWriteDrain::hasFurtherRequest(Bank bank)
+{
+    if (readBuffer.getNumberOfRequests(bank) + writeBuffer.getNumberOfRequests(bank) >= 2)
+        return true;
+    else
+        return false;
+}
+
+tlm_generic_payload *SchedulerWriteDrain::getForwardingWrite(tlm_generic_payload *payload)
+{
+    if (payload->get_command() != TLM_READ_COMMAND)
+        return nullptr;
+
+    // All pending writes are older than the new read, the youngest one holds the current data
+    tlm_generic_payload *youngestWrite = nullptr;
+    auto range = pendingWrites.equal_range(payload->get_address());
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (youngestWrite == nullptr || DramExtension::getPayloadID(it->second) > DramExtension::getPayloadID(youngestWrite))
+            youngestWrite = it->second;
+    }
+
+    // A shorter write cannot provide all data, the read then waits for the write in getNextRequest
+    if (youngestWrite != nullptr && youngestWrite->get_data_length() >= payload->get_data_length())
+        return youngestWrite;
+    else
+        return nullptr;
+}
+
+bool SchedulerWriteDrain::hasPriorityChanged()
+{
+    bool changed = modeChanged;
+    modeChanged = false;
+    return changed;
+}
+
+void SchedulerWriteDrain::printStatistics(const std::string &name) const
+{
+    std::cout << name << std::string("  Read/write turnarounds: ") << numberOfTurnarounds << std::endl;
+}
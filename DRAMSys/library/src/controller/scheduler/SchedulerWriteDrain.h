@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef SCHEDULERWRITEDRAIN_H
+#define SCHEDULERWRITEDRAIN_H
+
+#include <tlm.h>
+#include <unordered_map>
+#include "SchedulerIF.h"
+#include "RequestBuffer.h"
+#include "../../common/dramExtensions.h"
+#include "../BankMachine.h"
+
+// FR-FCFS scheduler with separate read and write buffers: reads are served with priority, writes are
+// drained in bursts from the high to the low watermark (or while no reads are pending)
+class SchedulerWriteDrain : public SchedulerIF
+{
+public:
+    SchedulerWriteDrain();
+    virtual void storeRequest(tlm::tlm_generic_payload *) override;
+    virtual void removeRequest(tlm::tlm_generic_payload *) override;
+    virtual tlm::tlm_generic_payload *getNextRequest(BankMachine *) override;
+    virtual bool hasFurtherRowHit(Bank, Row) override;
+    virtual bool hasFurtherRequest(Bank) override;
+    virtual tlm::tlm_generic_payload *getForwardingWrite(tlm::tlm_generic_payload *) override;
+    virtual bool hasPriorityChanged() override;
+    virtual void printStatistics(const std::string &) const override;
+
+private:
+    void updateMode();
+    tlm::tlm_generic_payload *getOldestRequest(uint64_t address);
+    static void removeFromMap(std::unordered_multimap<uint64_t, tlm::tlm_generic_payload *> &,
+                              tlm::tlm_generic_payload *);
+
+    RequestBuffer readBuffer;
+    RequestBuffer writeBuffer;
+    unsigned numberOfReads = 0;
+    unsigned numberOfWrites = 0;
+    unsigned highWatermark;
+    unsigned lowWatermark;
+    bool drainWrites = false;
+    bool modeChanged = false;
+
+    // Pending writes and reads of each address, requests to the same address are served in arrival order
+    // (read-after-write and write-after-read hazards), the youngest write also forwards its data to new reads
+    std::unordered_multimap<uint64_t, tlm::tlm_generic_payload *> pendingWrites;
+    std::unordered_multimap<uint64_t, tlm::tlm_generic_payload *> pendingReads;
+
+    tlm::tlm_command lastCommand = tlm::TLM_IGNORE_COMMAND;
+    uint64_t numberOfTurnarounds = 0;
+};
+
+#endif // SCHEDULERWRITEDRAIN_H
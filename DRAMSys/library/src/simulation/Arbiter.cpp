@@ -38,11 +38,13 @@
 #include "Arbiter.h"
 #include "../common/AddressDecoder.h"
 #include "../configuration/Configuration.h"
+#include "../common/DebugManager.h"
+#include <algorithm>
 
 using namespace tlm;
 
 Arbiter::Arbiter(sc_module_name name, std::string pathToAddressMapping) :
-    sc_module(name), payloadEventQueue(this, &Arbiter::peqCallback)
+    sc_module(name), payloadEventQueue(this, &Arbiter::peqCallback), subRequestPool(128)
 {
     // The arbiter communicates with one or more memory unity through one or more sockets (one or more memory channels).
     // Each of the arbiter's initiator sockets is bound to a memory controller's target socket.
@@ -53,9 +55,29 @@ Arbiter::Arbiter(sc_module_name name, std::string pathToAddressMapping) :
     {
         channelIsFree.push_back(true);
         pendingRequests.push_back(std::queue<tlm_generic_payload *>());
+        pendingRequestsPerThread.push_back(std::vector<std::queue<tlm_generic_payload *>>());
+        lastThread.push_back(0);
+        remainingGrants.push_back(0);
         nextPayloadID.push_back(0);
     }
 
+    std::string policy = Configuration::getInstance().arbitrationPolicy;
+    if (policy == "Fifo")
+        arbitrationPolicy = ArbitrationPolicy::Fifo;
+    else if (policy == "RoundRobin")
+        arbitrationPolicy = ArbitrationPolicy::RoundRobin;
+    else if (policy == "WeightedRoundRobin")
+        arbitrationPolicy = ArbitrationPolicy::WeightedRoundRobin;
+    else if (policy == "StrictPriority")
+        arbitrationPolicy = ArbitrationPolicy::StrictPriority;
+    else
+        SC_REPORT_FATAL("Arbiter", "Selected arbitration policy not supported!");
+    agingThreshold = Configuration::getInstance().arbitrationAgingThreshold
+            * Configuration::getInstance().memSpec->tCK;
+    reorderResponses = Configuration::getInstance().reorderResponses;
+    bytesPerBurst = Configuration::getInstance().getBytesPerBurst();
+    dataBytesPerBurst = Configuration::getInstance().adjustNumBytesAfterECC(bytesPerBurst);
+
     // One or more devices can accesss all the memory units through the arbiter.
     // Devices' initiator sockets are bound to arbiter's target sockets.
     // As soon the arbiter receives a request in any of its target sockets it should treat and forward it to the proper memory channel.
@@ -67,6 +89,27 @@ Arbiter::Arbiter(sc_module_name name, std::string pathToAddressMapping) :
     addressDecoder->print();
 }
 
+Arbiter::~Arbiter()
+{
+    PRINTDEBUGMESSAGE(name(), "Extension allocations: " + std::to_string(extensionAllocations));
+    PRINTDEBUGMESSAGE(name(), "Extension reuses: " + std::to_string(extensionReuses));
+    PRINTDEBUGMESSAGE(name(), "Sub-request payloads: " + std::to_string(subRequestPool.getNumberOfAllocations()));
+
+    for (unsigned int threadId = 0; threadId < reorderStatistics.size(); threadId++)
+    {
+        const ReorderStatistics &statistics = reorderStatistics[threadId];
+        if (statistics.responses == 0)
+            continue;
+        std::cout << name() << std::string("  Thread ") << threadId
+                  << std::string(" delayed responses: ") << statistics.delayedResponses
+                  << std::string(" of ") << statistics.responses
+                  << std::string(", average reorder latency: ") << statistics.totalDelay / statistics.responses
+                  << std::string(", maximum reorder latency: ") << statistics.maxDelay << std::endl;
+    }
+
+    delete addressDecoder;
+}
+
 // Initiated by initiator side
 // This function is called when an arbiter's target socket receives a transaction from a device
 tlm_sync_enum Arbiter::nb_transport_fw(int id, tlm_generic_payload &payload,
@@ -86,6 +129,23 @@ tlm_sync_enum Arbiter::nb_transport_fw(int id, tlm_generic_payload &payload,
         // It will extracted from the payload and used later.
         appendDramExtension(id, payload);
         payload.acquire();
+
+        if (reorderResponses)
+        {
+            if ((unsigned int)id >= reorderBuffers.size())
+            {
+                reorderBuffers.resize(id + 1);
+                reorderStatistics.resize(id + 1);
+            }
+            DramExtension::getExtension(payload).setThreadPayloadID(reorderBuffers[id].reserve());
+        }
+
+        if (payload.get_data_length() > dataBytesPerBurst)
+        {
+            // The sub-requests are notified instead of the original request
+            splitRequest(id, payload, notDelay);
+            return TLM_ACCEPTED;
+        }
     }
     else if (phase == END_RESP)
     {
@@ -141,13 +201,15 @@ void Arbiter::peqCallback(tlm_generic_payload &payload, const tlm_phase &phase)
             channelIsFree[channelId] = false;
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = SC_ZERO_TIME;
-            iSocket[channelId]->nb_transport_fw(payload, tPhase, tDelay);
-            // TODO: early completion of channel controller!!!
+            tlm_sync_enum returnValue = iSocket[channelId]->nb_transport_fw(payload, tPhase, tDelay);
+            // Early completion of the request phase by the channel controller
+            if (returnValue == TLM_UPDATED)
+                payloadEventQueue.notify(payload, tPhase, tDelay);
         }
         else
         {
             // This channel is busy. Enqueue the new transaction which phase is BEGIN_REQ.
-            pendingRequests[channelId].push(&payload);
+            enqueuePendingRequest(channelId, threadId, &payload);
         }
     }
     // Phases initiated by the target side from arbiter's point of view (memory side)
@@ -155,23 +217,43 @@ void Arbiter::peqCallback(tlm_generic_payload &payload, const tlm_phase &phase)
     {
         channelIsFree[channelId] = true;
 
-        // The arbiter receives a transaction which phase is END_REQ from memory controller and forwards it to the requester device.
-        tlm_phase tPhase = END_REQ;
-        sc_time tDelay = SC_ZERO_TIME;
-        tSocket[threadId]->nb_transport_bw(payload, tPhase, tDelay);
+        SubRequestExtension *subRequestExtension = nullptr;
+        payload.get_extension(subRequestExtension);
+        if (subRequestExtension == nullptr)
+        {
+            // The arbiter receives a transaction which phase is END_REQ from memory controller and forwards it to the requester device.
+            tlm_phase tPhase = END_REQ;
+            sc_time tDelay = SC_ZERO_TIME;
+            tSocket[threadId]->nb_transport_bw(payload, tPhase, tDelay);
+        }
+        else
+        {
+            tlm_generic_payload *parent = subRequestExtension->parent;
+            SplitRequestExtension *splitRequestExtension = nullptr;
+            parent->get_extension(splitRequestExtension);
+            if (--splitRequestExtension->pendingEndReqs == 0)
+            {
+                // All sub-requests have been accepted, so the original request is accepted.
+                tlm_phase tPhase = END_REQ;
+                sc_time tDelay = SC_ZERO_TIME;
+                tSocket[threadId]->nb_transport_bw(*parent, tPhase, tDelay);
+            }
+        }
 
         // This channel is now free! Dispatch a new transaction (phase is BEGIN_REQ) from the queue, if any. Send it to the memory controller.
-        if (!pendingRequests[channelId].empty())
+        tlm_generic_payload *nextPayload = selectPendingRequest(channelId);
+        if (nextPayload != nullptr)
         {
             // Send ONE of the enqueued new transactions (phase is BEGIN_REQ) through this channel.
-            tlm_generic_payload &payloadToSend = *pendingRequests[channelId].front();
-            pendingRequests[channelId].pop();
+            tlm_generic_payload &payloadToSend = *nextPayload;
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = SC_ZERO_TIME;
-            iSocket[channelId]->nb_transport_fw(payloadToSend, tPhase, tDelay);
-            // TODO: early completion of channel controller
             // Mark the channel as busy again.
             channelIsFree[channelId] = false;
+            tlm_sync_enum returnValue = iSocket[channelId]->nb_transport_fw(payloadToSend, tPhase, tDelay);
+            // Early completion of the request phase by the channel controller
+            if (returnValue == TLM_UPDATED)
+                payloadEventQueue.notify(payloadToSend, tPhase, tDelay);
         }
     }
     else if (phase == BEGIN_RESP)
@@ -179,25 +261,67 @@ void Arbiter::peqCallback(tlm_generic_payload &payload, const tlm_phase &phase)
         // The arbiter receives a transaction in BEGIN_RESP phase
         // (that came from the memory side) and forwards it to the requester
         // device
-        if (pendingResponses[threadId].empty())
+        tlm_generic_payload *response = &payload;
+
+        SubRequestExtension *subRequestExtension = nullptr;
+        payload.get_extension(subRequestExtension);
+        if (subRequestExtension != nullptr)
         {
-            tlm_phase tPhase = BEGIN_RESP;
-            sc_time tDelay = SC_ZERO_TIME;
-            tlm_sync_enum returnValue = tSocket[threadId]->nb_transport_bw(payload, tPhase, tDelay);
-            if (returnValue != TLM_ACCEPTED)
+            // The arbiter acts as initiator of the sub-request and finishes it itself.
+            tlm_phase tPhase = END_RESP;
+            sc_time tDelay = Configuration::getInstance().memSpec->tCK;
+            iSocket[channelId]->nb_transport_fw(payload, tPhase, tDelay);
+
+            response = subRequestExtension->parent;
+            SplitRequestExtension *splitRequestExtension = nullptr;
+            response->get_extension(splitRequestExtension);
+            // Error states are negative, so the lowest status of all sub-requests is the worst one
+            splitRequestExtension->responseStatus = std::min(splitRequestExtension->responseStatus,
+                                                             payload.get_response_status());
+            payload.release();
+
+            // The original request is answered when all of its sub-requests are answered.
+            if (--splitRequestExtension->pendingResponses > 0)
+                return;
+            response->set_response_status(splitRequestExtension->responseStatus);
+        }
+
+        if (reorderResponses)
+        {
+            // Hold the response back until the responses of all older requests
+            // of this device have been forwarded
+            ReorderBuffer &reorderBuffer = reorderBuffers[threadId];
+            reorderBuffer.insert(DramExtension::getThreadPayloadID(response), response);
+
+            while (reorderBuffer.hasResponse())
             {
-                tPhase = END_RESP;
-                payloadEventQueue.notify(payload, tPhase, tDelay);
+                tlm_generic_payload &payloadToSend = *reorderBuffer.getResponse();
+                sc_time reorderDelay = sc_time_stamp() - reorderBuffer.getArrivalTime();
+                reorderBuffer.removeResponse();
+
+                ReorderStatistics &statistics = reorderStatistics[threadId];
+                statistics.responses++;
+                if (reorderDelay > SC_ZERO_TIME)
+                {
+                    statistics.delayedResponses++;
+                    statistics.totalDelay += reorderDelay;
+                    statistics.maxDelay = std::max(statistics.maxDelay, reorderDelay);
+                }
+
+                forwardResponse(threadId, payloadToSend);
             }
         }
-
-        // Enqueue the transaction in BEGIN_RESP phase until the initiator
-        // device acknowledges it (phase changes to END_RESP).
-        pendingResponses[threadId].push(&payload);
+        else
+            forwardResponse(threadId, *response);
     }
     else if (phase == END_RESP)
     {
-        // Send the END_RESP message to the memory
+        // Send the END_RESP message to the memory (split requests have already been finished there)
+        SplitRequestExtension *splitRequestExtension = nullptr;
+        payload.get_extension(splitRequestExtension);
+        if (splitRequestExtension != nullptr && splitRequestExtension->isSplit)
+            splitRequestExtension->isSplit = false;
+        else
         {
             tlm_phase tPhase = END_RESP;
             sc_time tDelay = SC_ZERO_TIME;
@@ -228,18 +352,233 @@ void Arbiter::peqCallback(tlm_generic_payload &payload, const tlm_phase &phase)
             "Payload event queue in arbiter was triggered with unknown phase");
 }
 
+void Arbiter::splitRequest(int socketId, tlm_generic_payload &payload, const sc_time &delay)
+{
+    unsigned int dataLength = payload.get_data_length();
+    if (dataLength % dataBytesPerBurst != 0 || payload.get_address() % bytesPerBurst != 0)
+        SC_REPORT_FATAL("Arbiter", "Requests longer than one burst must be burst-aligned!");
+
+    unsigned int numberOfSubRequests = dataLength / dataBytesPerBurst;
+
+    // Like the DRAM extensions, the split request extension stays attached to the payload and is reused
+    SplitRequestExtension *splitRequestExtension = nullptr;
+    payload.get_extension(splitRequestExtension);
+    if (splitRequestExtension == nullptr)
+    {
+        splitRequestExtension = new SplitRequestExtension();
+        payload.set_extension(splitRequestExtension);
+        extensionAllocations++;
+    }
+    else
+        extensionReuses++;
+    splitRequestExtension->isSplit = true;
+    splitRequestExtension->pendingEndReqs = numberOfSubRequests;
+    splitRequestExtension->pendingResponses = numberOfSubRequests;
+    splitRequestExtension->responseStatus = TLM_OK_RESPONSE;
+
+    // The sub-requests are arbitrated with the priority and weight of the original request
+    PriorityExtension priority(PriorityExtension::getPriority(&payload),
+                               PriorityExtension::getWeight(&payload));
+
+    for (unsigned int index = 0; index < numberOfSubRequests; index++)
+    {
+        // The sub-requests share the data buffer of the original request, so no data is copied.
+        tlm_generic_payload *subRequest = subRequestPool.allocate();
+        subRequest->acquire();
+        subRequest->set_command(payload.get_command());
+        subRequest->set_address(payload.get_address() + index * bytesPerBurst);
+        subRequest->set_data_ptr(payload.get_data_ptr() + index * dataBytesPerBurst);
+        subRequest->set_data_length(dataBytesPerBurst);
+        subRequest->set_streaming_width(Configuration::getInstance().memSpec->burstLength);
+        subRequest->set_byte_enable_length(0);
+        subRequest->set_dmi_allowed(false);
+        subRequest->set_response_status(TLM_INCOMPLETE_RESPONSE);
+
+        SubRequestExtension *subRequestExtension = nullptr;
+        subRequest->get_extension(subRequestExtension);
+        subRequestExtension->parent = &payload;
+
+        PriorityExtension *subRequestPriority = nullptr;
+        subRequest->get_extension(subRequestPriority);
+        if (subRequestPriority == nullptr)
+        {
+            subRequest->set_extension(new PriorityExtension(priority));
+            extensionAllocations++;
+        }
+        else
+        {
+            *subRequestPriority = priority;
+            extensionReuses++;
+        }
+
+        appendDramExtension(socketId, *subRequest);
+        payloadEventQueue.notify(*subRequest, BEGIN_REQ, delay);
+    }
+}
+
+void Arbiter::forwardResponse(unsigned int threadId, tlm_generic_payload &payload)
+{
+    if (pendingResponses[threadId].empty())
+    {
+        tlm_phase tPhase = BEGIN_RESP;
+        sc_time tDelay = SC_ZERO_TIME;
+        tlm_sync_enum returnValue = tSocket[threadId]->nb_transport_bw(payload, tPhase, tDelay);
+        if (returnValue != TLM_ACCEPTED)
+        {
+            tPhase = END_RESP;
+            payloadEventQueue.notify(payload, tPhase, tDelay);
+        }
+    }
+
+    // Enqueue the transaction in BEGIN_RESP phase until the initiator
+    // device acknowledges it (phase changes to END_RESP).
+    pendingResponses[threadId].push(&payload);
+}
+
+void Arbiter::enqueuePendingRequest(unsigned int channelId, unsigned int threadId, tlm_generic_payload *payload)
+{
+    if (arbitrationPolicy == ArbitrationPolicy::Fifo)
+        pendingRequests[channelId].push(payload);
+    else
+    {
+        if (threadId >= pendingRequestsPerThread[channelId].size())
+            pendingRequestsPerThread[channelId].resize(threadId + 1);
+        pendingRequestsPerThread[channelId][threadId].push(payload);
+    }
+}
+
+tlm_generic_payload *Arbiter::selectPendingRequest(unsigned int channelId)
+{
+    if (arbitrationPolicy == ArbitrationPolicy::Fifo)
+    {
+        if (pendingRequests[channelId].empty())
+            return nullptr;
+        tlm_generic_payload *payload = pendingRequests[channelId].front();
+        pendingRequests[channelId].pop();
+        return payload;
+    }
+
+    std::vector<std::queue<tlm_generic_payload *>> &queues = pendingRequestsPerThread[channelId];
+    unsigned int numberOfThreads = queues.size();
+    unsigned int selectedThread = numberOfThreads;
+
+    if (arbitrationPolicy == ArbitrationPolicy::WeightedRoundRobin && remainingGrants[channelId] > 0
+            && !queues[lastThread[channelId]].empty())
+    {
+        // The last initiator keeps the channel until its grants are used up
+        selectedThread = lastThread[channelId];
+    }
+    else
+    {
+        // Search in round-robin order starting after the last served initiator
+        bool selectedIsAged = false;
+        for (unsigned int offset = 1; offset <= numberOfThreads; offset++)
+        {
+            unsigned int threadId = (lastThread[channelId] + offset) % numberOfThreads;
+            if (queues[threadId].empty())
+                continue;
+
+            if (arbitrationPolicy != ArbitrationPolicy::StrictPriority)
+            {
+                selectedThread = threadId;
+                break;
+            }
+
+            // Strict priority: requests waiting longer than the aging threshold are served first (oldest first),
+            // otherwise the highest priority wins
+            const tlm_generic_payload *candidate = queues[threadId].front();
+            sc_time candidateArrival = GenerationExtension::getTimeOfGeneration(candidate);
+            bool candidateIsAged = (agingThreshold != SC_ZERO_TIME
+                                    && sc_time_stamp() - candidateArrival >= agingThreshold);
+
+            if (selectedThread == numberOfThreads)
+            {
+                selectedThread = threadId;
+                selectedIsAged = candidateIsAged;
+                continue;
+            }
+
+            const tlm_generic_payload *selected = queues[selectedThread].front();
+            if (candidateIsAged)
+            {
+                if (!selectedIsAged || candidateArrival < GenerationExtension::getTimeOfGeneration(selected))
+                {
+                    selectedThread = threadId;
+                    selectedIsAged = true;
+                }
+            }
+            else if (!selectedIsAged
+                     && PriorityExtension::getPriority(candidate) > PriorityExtension::getPriority(selected))
+                selectedThread = threadId;
+        }
+
+        if (selectedThread == numberOfThreads)
+            return nullptr;
+
+        if (arbitrationPolicy == ArbitrationPolicy::WeightedRoundRobin)
+            remainingGrants[channelId] = PriorityExtension::getWeight(queues[selectedThread].front());
+    }
+
+    if (remainingGrants[channelId] > 0)
+        remainingGrants[channelId]--;
+    lastThread[channelId] = selectedThread;
+
+    tlm_generic_payload *payload = queues[selectedThread].front();
+    queues[selectedThread].pop();
+    return payload;
+}
+
 void Arbiter::appendDramExtension(int socketId, tlm_generic_payload &payload)
 {
-    // Append Generation Extension
-    GenerationExtension *genExtension = new GenerationExtension(sc_time_stamp());
-    payload.set_auto_extension(genExtension);
+    // The extensions are not appended as auto extensions, i.e., they are not freed by reset()
+    // in the memory managers but stay attached to the payload until it is deleted.
+    // A recycled payload already carries them, so they are only reinitialized.
+    GenerationExtension *genExtension = nullptr;
+    payload.get_extension(genExtension);
+    if (genExtension == nullptr)
+    {
+        payload.set_extension(new GenerationExtension(sc_time_stamp()));
+        extensionAllocations++;
+    }
+    else
+    {
+        *genExtension = GenerationExtension(sc_time_stamp());
+        extensionReuses++;
+    }
 
     unsigned int burstlength = payload.get_streaming_width();
     DecodedAddress decodedAddress = addressDecoder->decodeAddress(payload.get_address());
-    DramExtension *extension = new DramExtension(Thread(socketId),
-                                                 Channel(decodedAddress.channel), Rank(decodedAddress.rank),
-                                                 BankGroup(decodedAddress.bankgroup), Bank(decodedAddress.bank),
-                                                 Row(decodedAddress.row), Column(decodedAddress.column),
-                                                 burstlength, nextPayloadID[decodedAddress.channel]++);
-    payload.set_auto_extension(extension);
+    DramExtension newExtension(Thread(socketId),
+                               Channel(decodedAddress.channel), Rank(decodedAddress.rank),
+                               BankGroup(decodedAddress.bankgroup), Bank(decodedAddress.bank),
+                               Row(decodedAddress.row), Column(decodedAddress.column),
+                               burstlength, nextPayloadID[decodedAddress.channel]++);
+
+    DramExtension *extension = nullptr;
+    payload.get_extension(extension);
+    if (extension == nullptr)
+    {
+        payload.set_extension(new DramExtension(newExtension));
+        extensionAllocations++;
+    }
+    else
+    {
+        *extension = newExtension;
+        extensionReuses++;
+    }
+}
+
+uint64_t Arbiter::getExtensionAllocations() const
+{
+    return extensionAllocations;
+}
+
+uint64_t Arbiter::getExtensionReuses() const
+{
+    return extensionReuses;
+}
+
+uint64_t Arbiter::getSubRequestPayloads() const
+{
+    return subRequestPool.getNumberOfAllocations();
 }
@@ -48,6 +48,8 @@
 #include <tlm_utils/peq_with_cb_and_phase.h>
 #include "../common/AddressDecoder.h"
 #include "../common/dramExtensions.h"
+#include "ReorderBuffer.h"
+#include "SubRequestPool.h"
 
 class Arbiter : public sc_module
 {
@@ -57,6 +59,11 @@ public:
 
     Arbiter(sc_module_name, std::string);
     SC_HAS_PROCESS(Arbiter);
+    virtual ~Arbiter();
+
+    uint64_t getExtensionAllocations() const;
+    uint64_t getExtensionReuses() const;
+    uint64_t getSubRequestPayloads() const;
 
 private:
     AddressDecoder *addressDecoder;
@@ -72,6 +79,36 @@ private:
     // This is a queue of responses comming from the memory side. The phase of these transactions is BEGIN_RESP.
     std::map<unsigned int, std::queue<tlm::tlm_generic_payload *>> pendingResponses;
 
+    // Arbitration between the initiators of one channel if the channel is busy
+    enum class ArbitrationPolicy {Fifo, RoundRobin, WeightedRoundRobin, StrictPriority} arbitrationPolicy;
+    // Queues of new transactions per channel and initiator (all policies except FIFO)
+    std::vector<std::vector<std::queue<tlm::tlm_generic_payload *>>> pendingRequestsPerThread;
+    std::vector<unsigned int> lastThread;
+    std::vector<unsigned int> remainingGrants;
+    sc_time agingThreshold;
+    void enqueuePendingRequest(unsigned int channelId, unsigned int threadId, tlm::tlm_generic_payload *payload);
+    tlm::tlm_generic_payload *selectPendingRequest(unsigned int channelId);
+
+    // Optional in-order delivery of the responses of each initiator across all channels
+    bool reorderResponses;
+    std::vector<ReorderBuffer> reorderBuffers;
+    struct ReorderStatistics
+    {
+        uint64_t responses = 0;
+        uint64_t delayedResponses = 0;
+        sc_time totalDelay = SC_ZERO_TIME;
+        sc_time maxDelay = SC_ZERO_TIME;
+    };
+    std::vector<ReorderStatistics> reorderStatistics;
+    void forwardResponse(unsigned int threadId, tlm::tlm_generic_payload &payload);
+
+    // Requests longer than one burst are split into burst-sized sub-requests
+    // Address range of one burst and its data length (larger if the ECC controller adds check bytes)
+    unsigned int bytesPerBurst;
+    unsigned int dataBytesPerBurst;
+    SubRequestPool subRequestPool;
+    void splitRequest(int socketId, tlm::tlm_generic_payload &payload, const sc_time &delay);
+
     // Initiated by initiator side
     // This function is called when an arbiter's target socket receives a transaction from a device
     tlm::tlm_sync_enum nb_transport_fw(int id, tlm::tlm_generic_payload &payload,
@@ -88,6 +125,10 @@ private:
 
     void appendDramExtension(int socketId, tlm::tlm_generic_payload &payload);
     std::vector<uint64_t> nextPayloadID;
+
+    // The extensions stay attached to the (pooled) payloads and are reinitialized on reuse
+    uint64_t extensionAllocations = 0;
+    uint64_t extensionReuses = 0;
 };
 
 #endif // ARBITER_H
@@ -45,7 +45,6 @@
 
 #include "dram/Dram.h"
 #include "Arbiter.h"
-#include "ReorderBuffer.h"
 #include <tlm_utils/multi_passthrough_target_socket.h>
 #include <tlm_utils/multi_passthrough_initiator_socket.h>
 #include "../common/tlm2_base_protocol_checker.h"
@@ -80,9 +79,6 @@ protected:
     // All transactions pass first through the ECC Controller
     ECCBaseClass *ecc;
 
-    // TODO: Each DRAM has a reorder buffer (check this!)
-    ReorderBuffer *reorder;
-
     // All transactions pass through the same arbiter
     Arbiter *arbiter;
 
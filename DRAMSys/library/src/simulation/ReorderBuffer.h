@@ -38,130 +38,76 @@
 #ifndef REORDERBUFFER_H
 #define REORDERBUFFER_H
 
-#include <deque>
-#include <set>
+#include <vector>
+#include <cstdint>
 #include <systemc.h>
 #include <tlm.h>
-#include <tlm_utils/simple_initiator_socket.h>
-#include <tlm_utils/simple_target_socket.h>
-#include <tlm_utils/peq_with_cb_and_phase.h>
 
-struct ReorderBuffer : public sc_module
+// Restores the request order of the responses of one initiator.
+// Each request reserves a sequence number, the responses are stored in a ring
+// buffer at the position of their sequence number and are released in order.
+class ReorderBuffer
 {
 public:
-    tlm_utils::simple_initiator_socket<ReorderBuffer> iSocket;
-    tlm_utils::simple_target_socket<ReorderBuffer> tSocket;
+    ReorderBuffer() : slots(16) {}
 
-    SC_CTOR(ReorderBuffer) :
-        payloadEventQueue(this, &ReorderBuffer::peqCallback),
-        responseIsPendingInInitator(false)
+    uint64_t reserve()
     {
-        iSocket.register_nb_transport_bw(this, &ReorderBuffer::nb_transport_bw);
-        tSocket.register_nb_transport_fw(this, &ReorderBuffer::nb_transport_fw);
+        if (nextSequenceNumber - oldestSequenceNumber == slots.size())
+            grow();
+        return nextSequenceNumber++;
     }
 
-private:
-    tlm_utils::peq_with_cb_and_phase<ReorderBuffer> payloadEventQueue;
-    std::deque<tlm::tlm_generic_payload *> pendingRequestsInOrder;
-    std::set<tlm::tlm_generic_payload *>   receivedResponses;
-
-    bool responseIsPendingInInitator;
-
-
-    // Initiated by dram side
-    tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload &payload, tlm::tlm_phase &phase,
-                                  sc_time &bwDelay)
+    void insert(uint64_t sequenceNumber, tlm::tlm_generic_payload *payload)
     {
-        payloadEventQueue.notify(payload, phase, bwDelay);
-        return tlm::TLM_ACCEPTED;
+        sc_assert(sequenceNumber >= oldestSequenceNumber && sequenceNumber < nextSequenceNumber);
+        Slot &slot = slots[sequenceNumber & (slots.size() - 1)];
+        slot.payload = payload;
+        slot.arrivalTime = sc_time_stamp();
     }
 
-    // Initiated by initator side (players)
-    tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload &payload, tlm::tlm_phase &phase,
-                                  sc_time &fwDelay)
+    // True if the response of the oldest outstanding request has arrived
+    bool hasResponse() const
     {
-        if (phase == tlm::BEGIN_REQ) {
-            payload.acquire();
-        } else if (phase == tlm::END_RESP) {
-            payload.release();
-        }
-
-        payloadEventQueue.notify(payload, phase, fwDelay);
-        return tlm::TLM_ACCEPTED;
+        return (oldestSequenceNumber != nextSequenceNumber
+                && slots[oldestSequenceNumber & (slots.size() - 1)].payload != nullptr);
     }
 
-    void peqCallback(tlm::tlm_generic_payload &payload, const tlm::tlm_phase &phase)
+    tlm::tlm_generic_payload *getResponse() const
     {
-        //Phases initiated by initiator side
-        if (phase == tlm::BEGIN_REQ) {
-            pendingRequestsInOrder.push_back(&payload);
-            sendToTarget(payload, phase, SC_ZERO_TIME );
-        }
-
-        else if (phase == tlm::END_RESP) {
-            responseIsPendingInInitator = false;
-            pendingRequestsInOrder.pop_front();
-            receivedResponses.erase(&payload);
-            sendNextResponse();
-        }
-
-        //Phases initiated by dram side
-        else if (phase == tlm::END_REQ) {
-            sendToInitiator(payload, phase, SC_ZERO_TIME);
-        } else if (phase == tlm::BEGIN_RESP) {
-            sendToTarget(payload, tlm::END_RESP, SC_ZERO_TIME);
-            receivedResponses.emplace(&payload);
-            sendNextResponse();
-        }
-
-
-        else {
-            SC_REPORT_FATAL(0,
-                            "Payload event queue in arbiter was triggered with unknown phase");
-        }
+        return slots[oldestSequenceNumber & (slots.size() - 1)].payload;
     }
 
-    void sendToTarget(tlm::tlm_generic_payload &payload, const tlm::tlm_phase &phase,
-                      const sc_time &delay)
+    sc_time getArrivalTime() const
     {
-        tlm::tlm_phase TPhase = phase;
-        sc_time TDelay = delay;
-        iSocket->nb_transport_fw(payload, TPhase, TDelay);
+        return slots[oldestSequenceNumber & (slots.size() - 1)].arrivalTime;
     }
 
-    void sendToInitiator(tlm::tlm_generic_payload &payload, const tlm::tlm_phase &phase,
-                         const sc_time &delay)
+    void removeResponse()
     {
+        slots[oldestSequenceNumber & (slots.size() - 1)].payload = nullptr;
+        oldestSequenceNumber++;
+    }
 
+private:
+    struct Slot
+    {
+        tlm::tlm_generic_payload *payload = nullptr;
+        sc_time arrivalTime;
+    };
 
-        sc_assert(phase == tlm::END_REQ ||
-                  (phase == tlm::BEGIN_RESP && pendingRequestsInOrder.front() == &payload
-                   && receivedResponses.count(&payload)));
-
-        tlm::tlm_phase TPhase = phase;
-        sc_time TDelay = delay;
-        tSocket->nb_transport_bw(payload, TPhase, TDelay);
-    }
+    // The number of slots is always a power of two
+    std::vector<Slot> slots;
+    uint64_t oldestSequenceNumber = 0;
+    uint64_t nextSequenceNumber = 0;
 
-    void sendNextResponse()
+    void grow()
     {
-        //only send the next response when there response for the oldest pending request (requestsInOrder.front())
-        //has been received
-        if (!responseIsPendingInInitator
-                && receivedResponses.count(pendingRequestsInOrder.front())) {
-            tlm::tlm_generic_payload *payloadToSend = pendingRequestsInOrder.front();
-            responseIsPendingInInitator = true;
-            sendToInitiator(*payloadToSend, tlm::BEGIN_RESP, SC_ZERO_TIME);
-        }
-//        else if(!responseIsPendingInInitator && receivedResponses.size()>0 && !receivedResponses.count(pendingRequestsInOrder.front())>0)
-//        {
-//            cout << "cant send this response, because we are still waiting for response of oldest pending request. Elemts in buffer: " <<  receivedResponses.size() << endl;
-//        }
+        std::vector<Slot> newSlots(slots.size() * 2);
+        for (uint64_t id = oldestSequenceNumber; id < nextSequenceNumber; id++)
+            newSlots[id & (newSlots.size() - 1)] = slots[id & (slots.size() - 1)];
+        slots.swap(newSlots);
     }
-
 };
 
-
-
-
 #endif // REORDERBUFFER_H
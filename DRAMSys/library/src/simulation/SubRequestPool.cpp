@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "SubRequestPool.h"
+#include "../common/dramExtensions.h"
+
+using namespace tlm;
+
+SubRequestPool::SubRequestPool(unsigned int initialSize)
+{
+    for (unsigned int i = 0; i < initialSize; i++)
+    {
+        tlm_generic_payload *payload = createPayload();
+        freePayloads.push_back(payload);
+    }
+}
+
+SubRequestPool::~SubRequestPool()
+{
+    for (auto payload : allPayloads)
+        delete payload;
+}
+
+tlm_generic_payload *SubRequestPool::allocate()
+{
+    if (freePayloads.empty())
+    {
+        return createPayload();
+    }
+    else
+    {
+        tlm_generic_payload *payload = freePayloads.back();
+        freePayloads.pop_back();
+        return payload;
+    }
+}
+
+tlm_generic_payload *SubRequestPool::createPayload()
+{
+    // The sub-request extension is not an auto extension, so it stays attached when the payload is reused
+    tlm_generic_payload *payload = new tlm_generic_payload(this);
+    payload->set_extension(new SubRequestExtension());
+    allPayloads.push_back(payload);
+    return payload;
+}
+
+void SubRequestPool::free(tlm_generic_payload *payload)
+{
+    payload->reset();
+    payload->set_data_ptr(nullptr);
+    freePayloads.push_back(payload);
+}
+
+uint64_t SubRequestPool::getNumberOfAllocations() const
+{
+    return allPayloads.size();
+}
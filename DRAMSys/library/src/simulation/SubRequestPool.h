@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef SUBREQUESTPOOL_H
+#define SUBREQUESTPOOL_H
+
+#include <tlm.h>
+#include <vector>
+
+// Pool of burst-sized payloads used by the arbiter to split large requests.
+// The payloads do not own a data buffer, they point into the data of the original request.
+// Each payload carries a SubRequestExtension that links it to the original request.
+class SubRequestPool final : public tlm::tlm_mm_interface
+{
+public:
+    SubRequestPool(unsigned int initialSize);
+    virtual ~SubRequestPool();
+    tlm::tlm_generic_payload *allocate();
+    virtual void free(tlm::tlm_generic_payload *payload) override;
+
+    uint64_t getNumberOfAllocations() const;
+
+private:
+    std::vector<tlm::tlm_generic_payload *> allPayloads;
+    std::vector<tlm::tlm_generic_payload *> freePayloads;
+    tlm::tlm_generic_payload *createPayload();
+};
+
+#endif // SUBREQUESTPOOL_H
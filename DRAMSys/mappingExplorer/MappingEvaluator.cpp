@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "MappingEvaluator.h"
+#include "common/AddressDecoder.h"
+#include "configuration/Configuration.h"
+#include "TraceReader.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+using json = nlohmann::json;
+
+double MappingStatistics::getRowHitRate() const
+{
+    return (accesses == 0) ? 0.0 : static_cast<double>(rowHits) / accesses;
+}
+
+double MappingStatistics::getRowConflictRate() const
+{
+    return (accesses == 0) ? 0.0 : static_cast<double>(rowConflicts) / accesses;
+}
+
+bool MappingStatistics::isBetterThan(const MappingStatistics &other) const
+{
+    if (rowConflicts != other.rowConflicts)
+        return rowConflicts < other.rowConflicts;
+    return bankBalance < other.bankBalance;
+}
+
+static double balance(const std::vector<uint64_t> &counts, uint64_t accesses)
+{
+    if (accesses == 0)
+        return 0.0;
+    uint64_t maximum = *std::max_element(counts.begin(), counts.end());
+    return static_cast<double>(maximum) * counts.size() / accesses;
+}
+
+// Number of addresses that are evaluated at once, the next chunk is read in the meantime
+static const size_t chunkSize = 1 << 20;
+static const unsigned noRowOpen = UINT32_MAX;
+
+// Evaluation state of one mapping that is carried over from one chunk of the trace to the next
+struct MappingState
+{
+    explicit MappingState(const json &mapping) : decoder(mapping)
+    {
+        const MemSpec *memSpec = Configuration::getInstance().memSpec;
+        numberOfBanks = memSpec->numberOfBanks;
+        numberOfBankGroups = memSpec->numberOfBankGroups;
+        maximumAddress = decoder.getMaximumAddress();
+        openRows.resize(memSpec->numberOfChannels * numberOfBanks, noRowOpen);
+        channelAccesses.resize(memSpec->numberOfChannels, 0);
+        bankGroupAccesses.resize(memSpec->numberOfChannels * numberOfBankGroups, 0);
+        bankAccesses.resize(memSpec->numberOfChannels * numberOfBanks, 0);
+    }
+
+    void evaluateChunk(const std::vector<uint64_t> &addresses)
+    {
+        for (uint64_t address : addresses)
+        {
+            if (address > maximumAddress)
+            {
+                statistics.outOfRange++;
+                continue;
+            }
+
+            DecodedAddress decAddr = decoder.decodeAddress(address);
+            unsigned bank = decAddr.channel * numberOfBanks + decAddr.bank;
+
+            if (openRows[bank] == decAddr.row)
+                statistics.rowHits++;
+            else if (openRows[bank] != noRowOpen)
+                statistics.rowConflicts++;
+            openRows[bank] = decAddr.row;
+
+            channelAccesses[decAddr.channel]++;
+            bankGroupAccesses[decAddr.channel * numberOfBankGroups + decAddr.bankgroup]++;
+            bankAccesses[bank]++;
+            statistics.accesses++;
+        }
+    }
+
+    MappingStatistics finish()
+    {
+        statistics.channelBalance = balance(channelAccesses, statistics.accesses);
+        statistics.bankGroupBalance = balance(bankGroupAccesses, statistics.accesses);
+        statistics.bankBalance = balance(bankAccesses, statistics.accesses);
+        return statistics;
+    }
+
+    AddressDecoder decoder;
+    unsigned numberOfBanks;
+    unsigned numberOfBankGroups;
+    uint64_t maximumAddress;
+    std::vector<unsigned> openRows;
+    std::vector<uint64_t> channelAccesses;
+    std::vector<uint64_t> bankGroupAccesses;
+    std::vector<uint64_t> bankAccesses;
+    MappingStatistics statistics;
+};
+
+MappingEvaluator::MappingEvaluator(const std::string &pathToTrace, unsigned numberOfThreads)
+    : pathToTrace(pathToTrace), numberOfThreads(std::max(numberOfThreads, 1u)) {}
+
+std::vector<MappingStatistics> MappingEvaluator::evaluate(const std::vector<std::string> &names,
+                                                          const std::vector<json> &mappings) const
+{
+    // The decoders are created sequentially because their construction may report errors,
+    // decoding itself does not modify them and is done in parallel.
+    std::vector<std::unique_ptr<MappingState>> states;
+    for (auto &mapping : mappings)
+        states.emplace_back(new MappingState(mapping));
+
+    TraceReader reader(pathToTrace);
+    std::vector<uint64_t> currentChunk;
+    std::vector<uint64_t> nextChunk;
+    currentChunk.reserve(chunkSize);
+    nextChunk.reserve(chunkSize);
+
+    bool available = reader.readAddresses(currentChunk, chunkSize);
+    while (available)
+    {
+        std::atomic<size_t> nextMapping(0);
+        auto worker = [&]()
+        {
+            for (size_t index = nextMapping++; index < states.size(); index = nextMapping++)
+                states[index]->evaluateChunk(currentChunk);
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned thread = 0; thread < std::min<size_t>(numberOfThreads, states.size()); thread++)
+            threads.emplace_back(worker);
+        // The next chunk is read while the current one is evaluated
+        available = reader.readAddresses(nextChunk, chunkSize);
+        for (auto &thread : threads)
+            thread.join();
+        std::swap(currentChunk, nextChunk);
+    }
+
+    std::vector<MappingStatistics> results;
+    for (size_t index = 0; index < states.size(); index++)
+    {
+        results.push_back(states[index]->finish());
+        results.back().name = names[index];
+        results.back().mapping = mappings[index];
+    }
+    return results;
+}
+
+MappingStatistics MappingEvaluator::searchXor(const std::string &name, const json &mapping) const
+{
+    MappingStatistics best = evaluate({name}, {mapping}).front();
+
+    std::vector<unsigned> targetBits;
+    std::vector<unsigned> rowBits;
+    json current = mapping;
+    for (auto field : {"BANK_BIT", "BANKGROUP_BIT", "CHANNEL_BIT"})
+    {
+        if (current[field].is_array())
+        {
+            for (auto bit : current[field])
+                targetBits.push_back(bit);
+        }
+    }
+    for (auto bit : current["ROW_BIT"])
+        rowBits.push_back(bit);
+
+    for (unsigned targetBit : targetBits)
+    {
+        std::vector<std::string> names;
+        std::vector<json> candidates;
+        for (unsigned rowBit : rowBits)
+        {
+            json candidate = current;
+            candidate["XOR"].push_back({{"FIRST", targetBit}, {"SECOND", rowBit}});
+            candidates.push_back(candidate);
+            names.push_back(name + " + XOR(" + std::to_string(targetBit) + "," + std::to_string(rowBit) + ")");
+        }
+
+        for (auto &result : evaluate(names, candidates))
+        {
+            if (result.isBetterThan(best))
+                best = result;
+        }
+        current = best.mapping;
+    }
+
+    best.name = name + " (searched)";
+    return best;
+}
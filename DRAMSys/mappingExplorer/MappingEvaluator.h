@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef MAPPINGEVALUATOR_H
+#define MAPPINGEVALUATOR_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "common/third_party/nlohmann/single_include/nlohmann/json.hpp"
+
+struct MappingStatistics
+{
+    std::string name;
+    nlohmann::json mapping;
+    uint64_t accesses = 0;
+    uint64_t outOfRange = 0;
+    uint64_t rowHits = 0;
+    uint64_t rowConflicts = 0;
+    // Maximum number of accesses to one unit divided by the average (1.0 is perfectly balanced)
+    double channelBalance = 0.0;
+    double bankGroupBalance = 0.0;
+    double bankBalance = 0.0;
+
+    double getRowHitRate() const;
+    double getRowConflictRate() const;
+    bool isBetterThan(const MappingStatistics &other) const;
+};
+
+// Evaluates address mappings analytically on a trace: every bank keeps the last accessed row
+// open, so each access is counted as row hit, row conflict (other row open) or first access.
+// The trace is streamed in chunks and all mappings of one call are evaluated in the same pass.
+class MappingEvaluator
+{
+public:
+    MappingEvaluator(const std::string &pathToTrace, unsigned numberOfThreads);
+
+    std::vector<MappingStatistics> evaluate(const std::vector<std::string> &names,
+                                            const std::vector<nlohmann::json> &mappings) const;
+
+    // Greedily adds XORs of bank, bank group and channel bits with row bits that reduce the row conflicts
+    // (one pass over the trace per bank, bank group and channel bit)
+    MappingStatistics searchXor(const std::string &name, const nlohmann::json &mapping) const;
+
+private:
+    std::string pathToTrace;
+    unsigned numberOfThreads;
+};
+
+#endif // MAPPINGEVALUATOR_H
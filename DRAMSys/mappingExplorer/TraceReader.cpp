@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "TraceReader.h"
+#include "StlParser.h"
+#include <algorithm>
+#include <cstring>
+#include <systemc.h>
+
+TraceReader::TraceReader(const std::string &pathToTrace)
+    : pathToTrace(pathToTrace), file(nullptr)
+{
+    // Compressed traces are identified by the extension before the compression suffix
+    std::string uncompressedName = DecompressionBuffer::removeCompressionExtension(pathToTrace);
+    size_t pos = uncompressedName.rfind('.');
+    if (pos == std::string::npos)
+        SC_REPORT_FATAL("TraceReader", ("Name of the trace file does not contain a valid extension: "
+                                        + pathToTrace).c_str());
+    std::string ext = uncompressedName.substr(pos + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    if (ext == "btr")
+        binary = true;
+    else if (ext == "stl" || ext == "rstl")
+        binary = false;
+    else
+        SC_REPORT_FATAL("TraceReader", ("Unsupported file extension in " + pathToTrace).c_str());
+
+    if (DecompressionBuffer::isCompressed(pathToTrace))
+    {
+        decompressionBuffer.reset(new DecompressionBuffer(pathToTrace));
+        file.rdbuf(decompressionBuffer.get());
+    }
+    else
+    {
+        plainFile.open(pathToTrace, binary ? std::ios::binary : std::ios::in);
+        if (!plainFile.is_open())
+            SC_REPORT_FATAL("TraceReader", ("Could not open trace " + pathToTrace).c_str());
+        file.rdbuf(plainFile.rdbuf());
+    }
+
+    if (binary)
+    {
+        // Only the records are read, the write data at the end of the file is not required
+        BinaryTraceHeader header;
+        file.read(reinterpret_cast<char *>(&header), sizeof(BinaryTraceHeader));
+        if (file.gcount() != sizeof(BinaryTraceHeader))
+            SC_REPORT_FATAL("TraceReader", "Binary trace is too short");
+        if (std::memcmp(header.magic, binaryTraceMagic, sizeof(binaryTraceMagic)) != 0
+                || header.version != binaryTraceVersion)
+            SC_REPORT_FATAL("TraceReader", "Unsupported binary trace format");
+        remainingRecords = header.numberOfTransactions;
+    }
+}
+
+bool TraceReader::readAddresses(std::vector<uint64_t> &addresses, size_t maximumNumber)
+{
+    addresses.clear();
+    if (binary)
+        readBinaryAddresses(addresses, maximumNumber);
+    else
+        readStlAddresses(addresses, maximumNumber);
+
+    if (addresses.empty() && decompressionBuffer != nullptr && !decompressionBuffer->getError().empty())
+        SC_REPORT_FATAL("TraceReader", ("Could not decompress trace file: "
+                                        + decompressionBuffer->getError()).c_str());
+    return !addresses.empty();
+}
+
+void TraceReader::readStlAddresses(std::vector<uint64_t> &addresses, size_t maximumNumber)
+{
+    while (addresses.size() < maximumNumber && std::getline(file, line))
+    {
+        lineCnt++;
+        // If the line starts with '#' (commented lines) the transaction is ignored.
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        const char *position = line.data();
+        const char *end = line.data() + line.size();
+        const char *token;
+        size_t tokenLength;
+
+        // Only the address is required, timestamp and command are skipped.
+        StlParser::nextToken(position, end, token, tokenLength);
+        StlParser::nextToken(position, end, token, tokenLength);
+        StlParser::nextToken(position, end, token, tokenLength);
+        uint64_t address;
+        if (!StlParser::parseHex(token, tokenLength, address))
+            SC_REPORT_FATAL("TraceReader", ("Malformed trace file. Address could not be found (line "
+                                            + std::to_string(lineCnt) + ").").c_str());
+        addresses.push_back(address);
+    }
+}
+
+void TraceReader::readBinaryAddresses(std::vector<uint64_t> &addresses, size_t maximumNumber)
+{
+    size_t numberOfRecords = static_cast<size_t>(std::min<uint64_t>(remainingRecords, maximumNumber));
+    if (numberOfRecords == 0)
+        return;
+
+    records.resize(numberOfRecords);
+    file.read(reinterpret_cast<char *>(records.data()), numberOfRecords * sizeof(BinaryTraceRecord));
+    if (static_cast<size_t>(file.gcount()) != numberOfRecords * sizeof(BinaryTraceRecord))
+        SC_REPORT_FATAL("TraceReader", "Binary trace is truncated");
+    remainingRecords -= numberOfRecords;
+
+    for (const BinaryTraceRecord &record : records)
+        addresses.push_back(record.address);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef TRACEREADER_H
+#define TRACEREADER_H
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DecompressionBuffer.h"
+#include "BinaryTrace.h"
+
+// Reads the addresses of STL (.stl, .rstl) and binary (.btr) traces in chunks, so the trace does not
+// have to fit into memory. Compressed traces (.gz, .xz, .zst) are decompressed on the fly.
+class TraceReader
+{
+public:
+    explicit TraceReader(const std::string &pathToTrace);
+
+    // Replaces the content of addresses with the next (at most maximumNumber) addresses of the trace,
+    // returns false if the end of the trace was reached before
+    bool readAddresses(std::vector<uint64_t> &addresses, size_t maximumNumber);
+
+private:
+    void readStlAddresses(std::vector<uint64_t> &addresses, size_t maximumNumber);
+    void readBinaryAddresses(std::vector<uint64_t> &addresses, size_t maximumNumber);
+
+    std::string pathToTrace;
+    std::ifstream plainFile;
+    std::unique_ptr<DecompressionBuffer> decompressionBuffer;
+    std::istream file;
+    bool binary;
+
+    std::string line;
+    uint64_t lineCnt = 0;
+
+    uint64_t remainingRecords = 0;
+    std::vector<BinaryTraceRecord> records;
+};
+
+#endif // TRACEREADER_H
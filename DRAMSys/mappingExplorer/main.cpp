@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <systemc.h>
+
+#include "MappingEvaluator.h"
+#include "common/AddressDecoder.h"
+#include "configuration/Configuration.h"
+
+static void printStatistics(const MappingStatistics &statistics)
+{
+    std::cout << std::left << std::setw(60) << statistics.name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(10) << statistics.getRowHitRate()
+              << std::setw(10) << statistics.getRowConflictRate()
+              << std::setw(10) << statistics.channelBalance
+              << std::setw(10) << statistics.bankGroupBalance
+              << std::setw(10) << statistics.bankBalance << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    return sc_main(argc, argv);
+}
+
+int sc_main(int argc, char **argv)
+{
+    std::string memSpec;
+    std::string trace;
+    std::vector<std::string> addressMappings;
+    bool search = false;
+    unsigned numberOfThreads = std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if (argument == "--search")
+            search = true;
+        else if (argument == "--threads" && i + 1 < argc)
+            numberOfThreads = std::stoul(argv[++i]);
+        else if (memSpec.empty())
+            memSpec = argument;
+        else if (trace.empty())
+            trace = argument;
+        else
+            addressMappings.push_back(argument);
+    }
+
+    if (addressMappings.empty())
+    {
+        std::cout << "Usage: " << argv[0]
+                  << " <memspec> <trace> <address mapping> [<address mapping> ...] [--search] [--threads <n>]"
+                  << std::endl;
+        return 1;
+    }
+
+    Configuration::getInstance().loadMemSpec(Configuration::getInstance(), memSpec);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::vector<nlohmann::json> mappings;
+    for (auto &addressMapping : addressMappings)
+        mappings.push_back(AddressDecoder::loadMapping(addressMapping));
+
+    MappingEvaluator evaluator(trace, numberOfThreads);
+    std::vector<MappingStatistics> results = evaluator.evaluate(addressMappings, mappings);
+
+    if (search)
+    {
+        for (size_t i = 0; i < mappings.size(); i++)
+            results.push_back(evaluator.searchXor(addressMappings[i], mappings[i]));
+    }
+
+    std::cout << std::left << std::setw(60) << "Mapping" << std::right
+              << std::setw(10) << "Hits" << std::setw(10) << "Conflicts"
+              << std::setw(10) << "Channel" << std::setw(10) << "BankGroup"
+              << std::setw(10) << "Bank" << std::endl;
+    for (auto &result : results)
+        printStatistics(result);
+
+    if (search)
+    {
+        std::cout << std::endl << "XORs of the searched mappings:" << std::endl;
+        for (size_t i = mappings.size(); i < results.size(); i++)
+            std::cout << results[i].name << ": " << results[i].mapping["XOR"].dump() << std::endl;
+    }
+
+    if (results.front().outOfRange > 0)
+        std::cout << std::endl << results.front().outOfRange << " addresses are out of range and were ignored." << std::endl;
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+    std::cout << std::endl << results.front().accesses + results.front().outOfRange << " transactions evaluated in "
+              << std::to_string(elapsed.count()) << " seconds." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+// Checks the compiled AddressDecoder against the previous bit-by-bit decoding and times both.
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <systemc.h>
+
+#include "common/AddressDecoder.h"
+#include "configuration/Configuration.h"
+
+using json = nlohmann::json;
+
+// Reference implementation: the XORs are applied and the fields are gathered one bit at a time
+class BitwiseDecoder
+{
+public:
+    explicit BitwiseDecoder(json mapping)
+    {
+        for (auto xorItem : mapping["XOR"].items())
+        {
+            auto value = xorItem.value();
+            if (!value.empty())
+                vXor.push_back(std::pair<unsigned, unsigned>(value["FIRST"], value["SECOND"]));
+        }
+
+        vChannelBits = getBits(mapping, "CHANNEL_BIT");
+        vRankBits = getBits(mapping, "RANK_BIT");
+        vBankGroupBits = getBits(mapping, "BANKGROUP_BIT");
+        vBankBits = getBits(mapping, "BANK_BIT");
+        vRowBits = getBits(mapping, "ROW_BIT");
+        vColumnBits = getBits(mapping, "COLUMN_BIT");
+        vByteBits = getBits(mapping, "BYTE_BIT");
+
+        bankgroupsPerRank = 1u << vBankGroupBits.size();
+        banksPerGroup = 1u << vBankBits.size();
+    }
+
+    DecodedAddress decodeAddress(uint64_t encAddr) const
+    {
+        for (auto it = vXor.begin(); it != vXor.end(); it++)
+        {
+            uint64_t xoredBit;
+            xoredBit = (((encAddr >> it->first) & UINT64_C(1)) ^ ((encAddr >> it->second) & UINT64_C(1)));
+            encAddr &= ~(UINT64_C(1) << it->first);
+            encAddr |= xoredBit << it->first;
+        }
+
+        DecodedAddress decAddr;
+        decAddr.channel = gatherBits(vChannelBits, encAddr);
+        decAddr.rank = gatherBits(vRankBits, encAddr);
+        decAddr.bankgroup = gatherBits(vBankGroupBits, encAddr);
+        decAddr.bank = gatherBits(vBankBits, encAddr);
+        decAddr.row = gatherBits(vRowBits, encAddr);
+        decAddr.column = gatherBits(vColumnBits, encAddr);
+        decAddr.byte = gatherBits(vByteBits, encAddr);
+
+        decAddr.bankgroup = decAddr.bankgroup + decAddr.rank * bankgroupsPerRank;
+        decAddr.bank = decAddr.bank + decAddr.bankgroup * banksPerGroup;
+        return decAddr;
+    }
+
+private:
+    static std::vector<unsigned> getBits(json &mapping, const std::string &name)
+    {
+        std::vector<unsigned> bits;
+        if (mapping[name].is_array())
+        {
+            for (auto bit : mapping[name])
+                bits.push_back(bit);
+        }
+        return bits;
+    }
+
+    static unsigned gatherBits(const std::vector<unsigned> &bits, uint64_t encAddr)
+    {
+        unsigned value = 0;
+        for (unsigned it = 0; it < bits.size(); it++)
+            value |= ((encAddr >> bits[it]) & UINT64_C(1)) << it;
+        return value;
+    }
+
+    std::vector<std::pair<unsigned, unsigned>> vXor;
+    std::vector<unsigned> vChannelBits;
+    std::vector<unsigned> vRankBits;
+    std::vector<unsigned> vBankGroupBits;
+    std::vector<unsigned> vBankBits;
+    std::vector<unsigned> vRowBits;
+    std::vector<unsigned> vColumnBits;
+    std::vector<unsigned> vByteBits;
+    unsigned bankgroupsPerRank;
+    unsigned banksPerGroup;
+};
+
+static bool isEqual(const DecodedAddress &first, const DecodedAddress &second)
+{
+    return first.channel == second.channel && first.rank == second.rank
+            && first.bankgroup == second.bankgroup && first.bank == second.bank
+            && first.row == second.row && first.column == second.column && first.byte == second.byte;
+}
+
+// Decodes all addresses and returns the elapsed time in seconds, the checksum keeps the
+// compiler from removing the decoding
+template<typename Decoder>
+static double measure(Decoder &decoder, const std::vector<uint64_t> &addresses, uint64_t &checksum)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint64_t address : addresses)
+    {
+        DecodedAddress decAddr = decoder.decodeAddress(address);
+        checksum += decAddr.channel + decAddr.bank + decAddr.row + decAddr.column + decAddr.byte;
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = finish - start;
+    return elapsed.count();
+}
+
+int main(int argc, char **argv)
+{
+    return sc_main(argc, argv);
+}
+
+int sc_main(int argc, char **argv)
+{
+    if (argc != 3 && argc != 4)
+    {
+        std::cout << "Usage: " << argv[0] << " <memspec> <address mapping> [<number of addresses>]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t numberOfAddresses = (argc == 4) ? std::stoull(argv[3]) : 10000000;
+
+    Configuration::getInstance().loadMemSpec(Configuration::getInstance(), argv[1]);
+    json mapping = AddressDecoder::loadMapping(argv[2]);
+    AddressDecoder compiledDecoder(mapping);
+    BitwiseDecoder bitwiseDecoder(mapping);
+
+    // Random addresses within the range of the mapping, so no out-of-range warnings are reported
+    std::mt19937_64 generator(0);
+    std::uniform_int_distribution<uint64_t> distribution(0, compiledDecoder.getMaximumAddress());
+    std::vector<uint64_t> addresses(numberOfAddresses);
+    for (auto &address : addresses)
+        address = distribution(generator);
+
+    for (uint64_t address : addresses)
+    {
+        if (!isEqual(compiledDecoder.decodeAddress(address), bitwiseDecoder.decodeAddress(address)))
+        {
+            std::cerr << "Decoded addresses differ for address 0x" << std::hex << address << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    uint64_t checksum = 0;
+    double bitwiseTime = measure(bitwiseDecoder, addresses, checksum);
+    double compiledTime = measure(compiledDecoder, addresses, checksum);
+
+    std::cout << "Decoded " << numberOfAddresses << " addresses (checksum " << checksum << ")" << std::endl;
+    std::cout << std::fixed << std::setprecision(2)
+              << "Bit-by-bit: " << std::setw(8) << bitwiseTime * 1e9 / numberOfAddresses << " ns/address" << std::endl
+              << "Compiled:   " << std::setw(8) << compiledTime * 1e9 / numberOfAddresses << " ns/address" << std::endl
+              << "Speedup:    " << std::setw(8) << bitwiseTime / compiledTime << std::endl;
+    return 0;
+}
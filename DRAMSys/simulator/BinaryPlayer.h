@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef BINARYPLAYER_H
+#define BINARYPLAYER_H
+
+#include <cstring>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "TracePlayer.h"
+#include "BinaryTrace.h"
+
+// Plays a binary trace (.btr) that is mapped into memory, so no parsing is required.
+class BinaryPlayer : public TracePlayer
+{
+public:
+    BinaryPlayer(sc_module_name name,
+                 std::string pathToTrace,
+                 sc_time playerClk,
+                 TracePlayerListener *listener) :
+        TracePlayer(name, listener), playerClk(playerClk)
+    {
+#ifdef _WIN32
+        SC_REPORT_FATAL("BinaryPlayer", "Binary traces are not yet supported on Windows");
+#else
+        int fileDescriptor = open(pathToTrace.c_str(), O_RDONLY);
+        if (fileDescriptor == -1)
+            SC_REPORT_FATAL(0, (std::string("Could not open trace ") + pathToTrace).c_str());
+
+        struct stat fileStatus;
+        fstat(fileDescriptor, &fileStatus);
+        fileSize = fileStatus.st_size;
+        if (fileSize < sizeof(BinaryTraceHeader))
+            SC_REPORT_FATAL("BinaryPlayer", "Binary trace is too short");
+
+        fileContent = static_cast<const unsigned char *>(mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE,
+                                                              fileDescriptor, 0));
+        close(fileDescriptor);
+        if (fileContent == MAP_FAILED)
+            SC_REPORT_FATAL("BinaryPlayer", "Could not map binary trace into memory");
+        madvise(const_cast<unsigned char *>(fileContent), fileSize, MADV_SEQUENTIAL);
+#endif
+
+        const BinaryTraceHeader *header = reinterpret_cast<const BinaryTraceHeader *>(fileContent);
+        if (std::memcmp(header->magic, binaryTraceMagic, sizeof(binaryTraceMagic)) != 0
+                || header->version != binaryTraceVersion)
+            SC_REPORT_FATAL("BinaryPlayer", "Unsupported binary trace format");
+
+        relative = (header->relative != 0);
+        numberOfRecords = header->numberOfTransactions;
+        numberOfDataEntries = header->numberOfDataEntries;
+        records = reinterpret_cast<const BinaryTraceRecord *>(fileContent + sizeof(BinaryTraceHeader));
+        data = reinterpret_cast<const unsigned char *>(records + numberOfRecords);
+
+        if (sizeof(BinaryTraceHeader) + numberOfRecords * sizeof(BinaryTraceRecord)
+                + header->numberOfDataEntries * header->dataLength > fileSize)
+            SC_REPORT_FATAL("BinaryPlayer", "Binary trace is truncated");
+
+        burstlength = Configuration::getInstance().memSpec->burstLength;
+        dataLength = Configuration::getInstance().getBytesPerBurst();
+
+        if (storageEnabled && header->numberOfDataEntries > 0 && header->dataLength != dataLength)
+            SC_REPORT_FATAL("BinaryPlayer", "Data in the binary trace has an invalid length");
+    }
+
+    virtual ~BinaryPlayer()
+    {
+#ifndef _WIN32
+        munmap(const_cast<unsigned char *>(fileContent), fileSize);
+#endif
+    }
+
+    uint64_t getNumberOfRecords() const
+    {
+        return numberOfRecords;
+    }
+
+    void nextPayload()
+    {
+        if (recordIndex == numberOfRecords)
+        {
+            // The trace is finished. Nothing more to do.
+            this->finish();
+            return;
+        }
+
+        const BinaryTraceRecord &record = records[recordIndex];
+        recordIndex++;
+        numberOfTransactions++;
+
+        // Allocate a generic payload for this request.
+        tlm::tlm_generic_payload *payload = this->allocatePayload();
+        payload->acquire();
+
+        // Fill up the payload.
+        payload->set_address(record.address);
+        payload->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        payload->set_dmi_allowed(false);
+        payload->set_byte_enable_length(0);
+        payload->set_streaming_width(burstlength);
+        payload->set_data_length(dataLength);
+        payload->set_command(record.command == 0 ? tlm::TLM_READ_COMMAND : tlm::TLM_WRITE_COMMAND);
+        if (record.dataIndex != binaryTraceNoData && record.dataIndex >= numberOfDataEntries)
+            SC_REPORT_FATAL("BinaryPlayer", ("Record " + std::to_string(recordIndex - 1)
+                                             + " refers to missing write data").c_str());
+        if (storageEnabled && record.command != 0 && record.dataIndex != binaryTraceNoData)
+            std::memcpy(payload->get_data_ptr(), data + static_cast<uint64_t>(record.dataIndex) * dataLength,
+                        dataLength);
+
+        sc_time sendingTime = record.cycle * playerClk;
+        if (relative == false)
+        {
+            sendingTime += closedLoopDelay;
+            // Send the transaction directly or schedule it to be sent in the future.
+            if (sendingTime <= sc_time_stamp())
+                this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
+            else
+                this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, sendingTime - sc_time_stamp());
+        }
+        else
+            payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, sendingTime);
+    }
+
+private:
+    const unsigned char *fileContent = nullptr;
+    size_t fileSize = 0;
+    bool relative;
+    uint64_t numberOfRecords;
+    uint64_t numberOfDataEntries;
+    uint64_t recordIndex = 0;
+    const BinaryTraceRecord *records;
+    const unsigned char *data;
+
+    unsigned int burstlength;
+    unsigned int dataLength;
+    sc_time playerClk;  // May be different from the memory clock!
+};
+
+#endif // BINARYPLAYER_H
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef BINARYTRACE_H
+#define BINARYTRACE_H
+
+#include <cstdint>
+
+// Binary trace format (.btr): a header followed by fixed-width records and the write data.
+// All values are stored in the byte order of the host that converted the trace.
+//
+//   BinaryTraceHeader
+//   BinaryTraceRecord[numberOfTransactions]
+//   unsigned char[numberOfDataEntries][dataLength]
+
+const char binaryTraceMagic[8] = {'D', 'R', 'A', 'M', 'S', 'B', 'T', 'R'};
+const uint32_t binaryTraceVersion = 1;
+const uint32_t binaryTraceNoData = UINT32_MAX;
+
+struct BinaryTraceHeader
+{
+    char magic[8];
+    uint32_t version;
+    // Timestamps are relative to the previous request (like .rstl) instead of absolute (like .stl)
+    uint32_t relative;
+    // Number of bytes of each data entry (0 if the trace contains no data)
+    uint32_t dataLength;
+    uint32_t reserved;
+    uint64_t numberOfTransactions;
+    uint64_t numberOfDataEntries;
+};
+
+struct BinaryTraceRecord
+{
+    // Timestamp in clock cycles of the trace player
+    uint64_t cycle;
+    uint64_t address;
+    // 0: read, 1: write
+    uint32_t command;
+    // Index of the data entry or binaryTraceNoData
+    uint32_t dataIndex;
+};
+
+static_assert(sizeof(BinaryTraceHeader) == 40, "Unexpected padding in BinaryTraceHeader");
+static_assert(sizeof(BinaryTraceRecord) == 24, "Unexpected padding in BinaryTraceRecord");
+
+#endif // BINARYTRACE_H
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "DecompressionBuffer.h"
+#include <systemc>
+
+namespace
+{
+const size_t blockSize = 1024 * 1024;
+
+bool hasSuffix(const std::string &name, const std::string &suffix)
+{
+    return name.size() > suffix.size()
+            && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+}
+
+DecompressionBuffer::DecompressionBuffer(const std::string &pathToFile)
+    : file(pathToFile, std::ios::binary), inputBuffer(blockSize)
+{
+    if (!file.is_open())
+        SC_REPORT_FATAL("DecompressionBuffer", ("Could not open " + pathToFile).c_str());
+
+    if (hasSuffix(pathToFile, ".gz"))
+    {
+        format = Format::Gzip;
+#ifdef DRAMSYS_ZLIB
+        gzipStream = z_stream();
+        // 15 window bits plus 32 enables the automatic gzip/zlib header detection
+        if (inflateInit2(&gzipStream, 15 + 32) != Z_OK)
+            SC_REPORT_FATAL("DecompressionBuffer", "Could not initialize zlib");
+#else
+        SC_REPORT_FATAL("DecompressionBuffer", "DRAMSys was built without zlib, .gz files are not supported");
+#endif
+    }
+    else if (hasSuffix(pathToFile, ".xz"))
+    {
+        format = Format::Xz;
+#ifdef DRAMSYS_LZMA
+        if (lzma_stream_decoder(&xzStream, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK)
+            SC_REPORT_FATAL("DecompressionBuffer", "Could not initialize liblzma");
+#else
+        SC_REPORT_FATAL("DecompressionBuffer", "DRAMSys was built without liblzma, .xz files are not supported");
+#endif
+    }
+    else if (hasSuffix(pathToFile, ".zst"))
+    {
+        format = Format::Zstd;
+#ifdef DRAMSYS_ZSTD
+        zstdContext = ZSTD_createDCtx();
+        if (zstdContext == nullptr)
+            SC_REPORT_FATAL("DecompressionBuffer", "Could not initialize libzstd");
+#else
+        SC_REPORT_FATAL("DecompressionBuffer", "DRAMSys was built without libzstd, .zst files are not supported");
+#endif
+    }
+    else
+        SC_REPORT_FATAL("DecompressionBuffer", ("Unknown compression format of " + pathToFile).c_str());
+
+    for (auto &block : blocks)
+    {
+        block.data.resize(blockSize);
+        freeBlocks.push(&block);
+    }
+    setg(nullptr, nullptr, nullptr);
+    decompressionThread = std::thread(&DecompressionBuffer::decompressionLoop, this);
+}
+
+DecompressionBuffer::~DecompressionBuffer()
+{
+    {
+        std::lock_guard<std::mutex> lock(blockMutex);
+        stopDecompression = true;
+    }
+    blockCondition.notify_all();
+    decompressionThread.join();
+
+#ifdef DRAMSYS_ZLIB
+    if (format == Format::Gzip)
+        inflateEnd(&gzipStream);
+#endif
+#ifdef DRAMSYS_LZMA
+    if (format == Format::Xz)
+        lzma_end(&xzStream);
+#endif
+#ifdef DRAMSYS_ZSTD
+    if (format == Format::Zstd)
+        ZSTD_freeDCtx(zstdContext);
+#endif
+}
+
+bool DecompressionBuffer::isCompressed(const std::string &pathToFile)
+{
+    return hasSuffix(pathToFile, ".gz") || hasSuffix(pathToFile, ".xz") || hasSuffix(pathToFile, ".zst");
+}
+
+std::string DecompressionBuffer::removeCompressionExtension(const std::string &pathToFile)
+{
+    if (isCompressed(pathToFile))
+        return pathToFile.substr(0, pathToFile.rfind('.'));
+    else
+        return pathToFile;
+}
+
+const std::string &DecompressionBuffer::getError() const
+{
+    return error;
+}
+
+DecompressionBuffer::int_type DecompressionBuffer::underflow()
+{
+    while (gptr() == egptr())
+    {
+        if (currentBlock != nullptr)
+        {
+            if (currentBlock->last)
+                return traits_type::eof();
+            putBlock(freeBlocks, currentBlock);
+        }
+
+        // Take the next decompressed block, this only blocks if the helper thread is behind.
+        currentBlock = takeBlock(readyBlocks);
+        if (currentBlock == nullptr)
+            return traits_type::eof();
+        setg(currentBlock->data.data(), currentBlock->data.data(),
+             currentBlock->data.data() + currentBlock->size);
+    }
+    return traits_type::to_int_type(*gptr());
+}
+
+void DecompressionBuffer::decompressionLoop()
+{
+    while (true)
+    {
+        Block *block = takeBlock(freeBlocks);
+        if (block == nullptr)
+            return;
+
+        if (!fillBlock(*block))
+        {
+            // The error is read by the consumer after it reached the last block
+            block->last = true;
+        }
+        putBlock(readyBlocks, block);
+
+        if (block->last)
+            return;
+    }
+}
+
+bool DecompressionBuffer::fillBlock(Block &block)
+{
+    block.size = 0;
+    block.last = false;
+    while (block.size < block.data.size())
+    {
+        if (inputPosition == inputSize && !inputEnd)
+        {
+            file.read(inputBuffer.data(), inputBuffer.size());
+            inputSize = static_cast<size_t>(file.gcount());
+            inputPosition = 0;
+            if (!file)
+                inputEnd = true;
+        }
+
+        if (inputEnd && inputPosition == inputSize && frameComplete)
+        {
+            block.last = true;
+            return true;
+        }
+
+        size_t consumed = 0;
+        size_t written = 0;
+        StepResult result = decompressStep(block.data.data() + block.size,
+                                           block.data.size() - block.size, consumed, written);
+        inputPosition += consumed;
+        block.size += written;
+
+        if (result == StepResult::Error)
+            return false;
+        else if (result == StepResult::FrameEnd)
+            frameComplete = true;
+        else if (consumed > 0 || written > 0)
+            frameComplete = false;
+        else if (inputEnd && inputPosition == inputSize)
+        {
+            error = "Compressed file is truncated";
+            return false;
+        }
+    }
+    return true;
+}
+
+DecompressionBuffer::StepResult DecompressionBuffer::decompressStep(char *output, size_t outputSize,
+                                                                    size_t &consumed, size_t &written)
+{
+    const char *input = inputBuffer.data() + inputPosition;
+    size_t availableInput = inputSize - inputPosition;
+
+    if (format == Format::Gzip)
+    {
+#ifdef DRAMSYS_ZLIB
+        gzipStream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(input));
+        gzipStream.avail_in = static_cast<uInt>(availableInput);
+        gzipStream.next_out = reinterpret_cast<Bytef *>(output);
+        gzipStream.avail_out = static_cast<uInt>(outputSize);
+        int ret = inflate(&gzipStream, Z_NO_FLUSH);
+        consumed = availableInput - gzipStream.avail_in;
+        written = outputSize - gzipStream.avail_out;
+        if (ret == Z_STREAM_END)
+        {
+            // Files may consist of several concatenated gzip members
+            inflateReset(&gzipStream);
+            return StepResult::FrameEnd;
+        }
+        else if (ret == Z_OK || ret == Z_BUF_ERROR)
+            return StepResult::Ok;
+        error = std::string("zlib error: ") + (gzipStream.msg != nullptr ? gzipStream.msg : std::to_string(ret));
+#endif
+    }
+    else if (format == Format::Xz)
+    {
+#ifdef DRAMSYS_LZMA
+        xzStream.next_in = reinterpret_cast<const uint8_t *>(input);
+        xzStream.avail_in = availableInput;
+        xzStream.next_out = reinterpret_cast<uint8_t *>(output);
+        xzStream.avail_out = outputSize;
+        // With LZMA_CONCATENATED the decoder only finishes when told that the input ended
+        lzma_ret ret = lzma_code(&xzStream, inputEnd ? LZMA_FINISH : LZMA_RUN);
+        consumed = availableInput - xzStream.avail_in;
+        written = outputSize - xzStream.avail_out;
+        if (ret == LZMA_STREAM_END)
+            return StepResult::FrameEnd;
+        else if (ret == LZMA_OK || ret == LZMA_BUF_ERROR)
+            return StepResult::Ok;
+        error = "liblzma error " + std::to_string(ret);
+#endif
+    }
+    else // if (format == Format::Zstd)
+    {
+#ifdef DRAMSYS_ZSTD
+        ZSTD_inBuffer in = {input, availableInput, 0};
+        ZSTD_outBuffer out = {output, outputSize, 0};
+        size_t ret = ZSTD_decompressStream(zstdContext, &out, &in);
+        consumed = in.pos;
+        written = out.pos;
+        if (ZSTD_isError(ret))
+            error = std::string("libzstd error: ") + ZSTD_getErrorName(ret);
+        else if (ret == 0)
+            return StepResult::FrameEnd;
+        else
+            return StepResult::Ok;
+#endif
+    }
+    return StepResult::Error;
+}
+
+DecompressionBuffer::Block *DecompressionBuffer::takeBlock(SpscQueue<Block *, 8> &queue)
+{
+    Block *block = nullptr;
+    if (queue.pop(block))
+        return block;
+
+    std::unique_lock<std::mutex> lock(blockMutex);
+    blockCondition.wait(lock, [&]() { return queue.pop(block) || stopDecompression; });
+    return block;
+}
+
+void DecompressionBuffer::putBlock(SpscQueue<Block *, 8> &queue, Block *block)
+{
+    queue.push(block);
+    {
+        // Taking the mutex ensures that a waiting thread does not miss the notification
+        std::lock_guard<std::mutex> lock(blockMutex);
+    }
+    blockCondition.notify_all();
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef DECOMPRESSIONBUFFER_H
+#define DECOMPRESSIONBUFFER_H
+
+#include <streambuf>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <array>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "SpscQueue.h"
+
+#ifdef DRAMSYS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef DRAMSYS_LZMA
+#include <lzma.h>
+#endif
+#ifdef DRAMSYS_ZSTD
+#include <zstd.h>
+#endif
+
+// Input stream buffer for gzip (.gz), xz (.xz) and zstd (.zst) compressed files.
+// The file is decompressed in blocks by a helper thread while the reader consumes
+// the previously decompressed block.
+class DecompressionBuffer : public std::streambuf
+{
+public:
+    explicit DecompressionBuffer(const std::string &pathToFile);
+    virtual ~DecompressionBuffer();
+
+    static bool isCompressed(const std::string &pathToFile);
+    static std::string removeCompressionExtension(const std::string &pathToFile);
+
+    // Empty unless the decompression failed, valid after the end of the stream was reached
+    const std::string &getError() const;
+
+protected:
+    virtual int_type underflow() override;
+
+private:
+    enum class Format {Gzip, Xz, Zstd};
+    enum class StepResult {Ok, FrameEnd, Error};
+
+    struct Block
+    {
+        std::vector<char> data;
+        size_t size = 0;
+        bool last = false;
+    };
+
+    void decompressionLoop();
+    bool fillBlock(Block &block);
+    StepResult decompressStep(char *output, size_t outputSize, size_t &consumed, size_t &written);
+
+    Block *takeBlock(SpscQueue<Block *, 8> &queue);
+    void putBlock(SpscQueue<Block *, 8> &queue, Block *block);
+
+    Format format;
+    std::ifstream file;
+    std::vector<char> inputBuffer;
+    size_t inputPosition = 0;
+    size_t inputSize = 0;
+    bool inputEnd = false;
+    bool frameComplete = false;
+    std::string error;
+
+#ifdef DRAMSYS_ZLIB
+    z_stream gzipStream;
+#endif
+#ifdef DRAMSYS_LZMA
+    lzma_stream xzStream = LZMA_STREAM_INIT;
+#endif
+#ifdef DRAMSYS_ZSTD
+    ZSTD_DCtx *zstdContext = nullptr;
+#endif
+
+    std::array<Block, 4> blocks;
+    SpscQueue<Block *, 8> freeBlocks;
+    SpscQueue<Block *, 8> readyBlocks;
+    Block *currentBlock = nullptr;
+    std::thread decompressionThread;
+    std::mutex blockMutex;
+    std::condition_variable blockCondition;
+    bool stopDecompression = false;
+};
+
+#endif // DECOMPRESSIONBUFFER_H
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef ELASTICTRACEPLAYER_H
+#define ELASTICTRACEPLAYER_H
+
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "TracePlayer.h"
+#include "Gem5ProtoReader.h"
+
+// Plays the data dependency trace (.data.gz) of a gem5 elastic trace without gem5.
+// Like the gem5 TraceCPU, a record is executed when all its dependencies (ROB order and
+// register dependencies) are completed plus its compute delay. Loads complete with their
+// response, stores when they are issued and compute records after their compute delay.
+class ElasticTracePlayer : public TracePlayer
+{
+public:
+    ElasticTracePlayer(sc_module_name name,
+                       std::string pathToTrace,
+                       TracePlayerListener *listener) :
+        TracePlayer(name, listener), reader(pathToTrace)
+    {
+        if (!reader.readMessage())
+            SC_REPORT_FATAL("ElasticTracePlayer", "Trace does not contain a header");
+
+        // InstDepRecordHeader: obj_id = 1, ver = 2, tick_freq = 3, window_size = 4
+        uint64_t tickFrequency = 0;
+        Gem5ProtoReader::Field field;
+        while (reader.nextField(field))
+        {
+            if (field.number == 3)
+                tickFrequency = field.value;
+            else if (field.number == 4 && field.value != 0)
+                windowSize = field.value;
+        }
+        if (tickFrequency == 0)
+            SC_REPORT_FATAL("ElasticTracePlayer", "Trace does not define a tick frequency");
+        tickPeriod = sc_time(1.0 / tickFrequency, SC_SEC);
+
+        burstlength = Configuration::getInstance().memSpec->burstLength;
+        dataLength = Configuration::getInstance().getBytesPerBurst();
+    }
+
+    void nextPayload()
+    {
+        readRecords();
+
+        if (readyNodes.empty())
+        {
+            if (nodes.empty() && endOfTrace)
+                // The trace is finished. Nothing more to do.
+                this->finish();
+            else
+                // Continue when the next load completes
+                waitingForDependencies = true;
+            return;
+        }
+
+        sc_time executionTime = readyNodes.top().first;
+        uint64_t sequenceNumber = readyNodes.top().second;
+        readyNodes.pop();
+        const Node &node = nodes.at(sequenceNumber);
+
+        numberOfTransactions++;
+
+        // Allocate a generic payload for this request.
+        tlm::tlm_generic_payload *payload = this->allocatePayload();
+        payload->acquire();
+
+        // Fill up the payload.
+        payload->set_address(node.address);
+        payload->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        payload->set_dmi_allowed(false);
+        payload->set_byte_enable_length(0);
+        payload->set_streaming_width(burstlength);
+        payload->set_data_length(dataLength);
+        payload->set_command(node.type == RecordType::Load ? tlm::TLM_READ_COMMAND : tlm::TLM_WRITE_COMMAND);
+
+        // Send the transaction directly or schedule it to be sent in the future.
+        if (executionTime <= sc_time_stamp())
+        {
+            executionTime = sc_time_stamp();
+            this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
+        }
+        else
+            this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, executionTime - sc_time_stamp());
+
+        if (node.type == RecordType::Load)
+            outstandingLoads[payload] = sequenceNumber;
+        else
+            completeNode(sequenceNumber, executionTime);
+    }
+
+    static uint64_t getNumberOfMemoryRecords(std::string pathToTrace)
+    {
+        Gem5ProtoReader counter(pathToTrace);
+        Gem5ProtoReader::Field field;
+        uint64_t numberOfMemoryRecords = 0;
+        counter.readMessage();
+        while (counter.readMessage())
+        {
+            while (counter.nextField(field))
+            {
+                if (field.number == 2 && (field.value == static_cast<uint64_t>(RecordType::Load)
+                        || field.value == static_cast<uint64_t>(RecordType::Store)))
+                    numberOfMemoryRecords++;
+            }
+        }
+        return numberOfMemoryRecords;
+    }
+
+protected:
+    virtual void responseReceived(tlm::tlm_generic_payload &payload) override
+    {
+        auto it = outstandingLoads.find(&payload);
+        if (it == outstandingLoads.end())
+            return;
+
+        completeNode(it->second, sc_time_stamp());
+        outstandingLoads.erase(it);
+
+        if (waitingForDependencies)
+        {
+            waitingForDependencies = false;
+            nextPayload();
+        }
+    }
+
+private:
+    // InstDepRecord::RecordType
+    enum class RecordType {Invalid = 0, Load = 1, Store = 2, Comp = 3};
+
+    struct Node
+    {
+        RecordType type;
+        uint64_t address;
+        sc_time computeDelay;
+        // Completion time of the latest dependency
+        sc_time dependenciesCompleted;
+        unsigned int pendingDependencies = 0;
+        std::vector<uint64_t> dependents;
+    };
+
+    // Reads records until the window of uncompleted records is full
+    void readRecords()
+    {
+        while (!endOfTrace && nodes.size() < windowSize)
+        {
+            if (!reader.readMessage())
+            {
+                endOfTrace = true;
+                break;
+            }
+
+            // InstDepRecord: seq_num = 1, type = 2, p_addr = 3, size = 4, flags = 5,
+            // rob_dep = 6, comp_delay = 7, reg_dep = 8, weight = 9, pc = 10
+            uint64_t sequenceNumber = 0;
+            Node node;
+            node.type = RecordType::Invalid;
+            node.address = 0;
+            node.dependenciesCompleted = sc_time_stamp();
+            dependencies.clear();
+
+            Gem5ProtoReader::Field field;
+            while (reader.nextField(field))
+            {
+                if (field.number == 1)
+                    sequenceNumber = field.value;
+                else if (field.number == 6 || field.number == 8)
+                {
+                    if (field.wireType == 2)
+                    {
+                        // Packed repeated field
+                        const char *position = field.data;
+                        uint64_t dependency;
+                        while (Gem5ProtoReader::readVarint(position, field.data + field.length, dependency))
+                            dependencies.push_back(dependency);
+                    }
+                    else
+                        dependencies.push_back(field.value);
+                }
+                else if (field.number == 7)
+                    node.computeDelay = field.value * tickPeriod;
+                else if (field.number == 3)
+                    node.address = field.value;
+                else if (field.number == 2)
+                    node.type = static_cast<RecordType>(field.value);
+            }
+
+            if (node.type == RecordType::Invalid)
+                continue;
+
+            for (uint64_t dependency : dependencies)
+            {
+                auto it = nodes.find(dependency);
+                if (it != nodes.end())
+                {
+                    it->second.dependents.push_back(sequenceNumber);
+                    node.pendingDependencies++;
+                }
+                else
+                {
+                    // Dependencies older than the completion history are completed long ago
+                    auto completed = completionTimes.find(dependency);
+                    if (completed != completionTimes.end())
+                        node.dependenciesCompleted = std::max(node.dependenciesCompleted, completed->second);
+                }
+            }
+
+            Node &insertedNode = nodes.emplace(sequenceNumber, std::move(node)).first->second;
+            if (insertedNode.pendingDependencies == 0)
+                nodeReady(sequenceNumber, insertedNode);
+        }
+    }
+
+    void nodeReady(uint64_t sequenceNumber, const Node &node)
+    {
+        sc_time executionTime = node.dependenciesCompleted + node.computeDelay;
+        if (node.type == RecordType::Comp)
+            completionWorklist.emplace_back(sequenceNumber, executionTime);
+        else
+            readyNodes.emplace(executionTime, sequenceNumber);
+
+        if (!completingNodes)
+            processCompletions();
+    }
+
+    void completeNode(uint64_t sequenceNumber, sc_time completionTime)
+    {
+        completionWorklist.emplace_back(sequenceNumber, completionTime);
+        processCompletions();
+    }
+
+    // Completes the nodes of the worklist and releases their dependents (iterative, as
+    // chains of compute records can be long)
+    void processCompletions()
+    {
+        completingNodes = true;
+        while (!completionWorklist.empty())
+        {
+            uint64_t sequenceNumber = completionWorklist.back().first;
+            sc_time completionTime = completionWorklist.back().second;
+            completionWorklist.pop_back();
+
+            auto it = nodes.find(sequenceNumber);
+            std::vector<uint64_t> dependents = std::move(it->second.dependents);
+            nodes.erase(it);
+
+            completionTimes[sequenceNumber] = completionTime;
+            if (completionTimes.size() > 4 * windowSize)
+                completionTimes.erase(completionTimes.begin());
+
+            for (uint64_t dependent : dependents)
+            {
+                Node &node = nodes.at(dependent);
+                node.dependenciesCompleted = std::max(node.dependenciesCompleted, completionTime);
+                node.pendingDependencies--;
+                if (node.pendingDependencies == 0)
+                    nodeReady(dependent, node);
+            }
+        }
+        completingNodes = false;
+    }
+
+    Gem5ProtoReader reader;
+    sc_time tickPeriod;
+    uint64_t windowSize = 1024;
+    bool endOfTrace = false;
+    bool waitingForDependencies = false;
+    bool completingNodes = false;
+
+    unsigned int burstlength;
+    unsigned int dataLength;
+
+    // Records that are read but not yet completed
+    std::unordered_map<uint64_t, Node> nodes;
+    // Completion times of the recently completed records
+    std::map<uint64_t, sc_time> completionTimes;
+    // Loads and stores whose dependencies are completed, ordered by their execution time
+    std::priority_queue<std::pair<sc_time, uint64_t>, std::vector<std::pair<sc_time, uint64_t>>,
+                        std::greater<std::pair<sc_time, uint64_t>>> readyNodes;
+    std::unordered_map<tlm::tlm_generic_payload *, uint64_t> outstandingLoads;
+    std::vector<std::pair<uint64_t, sc_time>> completionWorklist;
+    std::vector<uint64_t> dependencies;
+};
+
+#endif // ELASTICTRACEPLAYER_H
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef GEM5PACKETPLAYER_H
+#define GEM5PACKETPLAYER_H
+
+#include "TracePlayer.h"
+#include "Gem5ProtoReader.h"
+
+// Plays a gem5 packet trace, e.g. the instruction fetch trace (.inst.gz) of an elastic trace.
+// Each packet is issued at its recorded tick.
+class Gem5PacketPlayer : public TracePlayer
+{
+public:
+    Gem5PacketPlayer(sc_module_name name,
+                     std::string pathToTrace,
+                     TracePlayerListener *listener) :
+        TracePlayer(name, listener), reader(pathToTrace)
+    {
+        if (!reader.readMessage())
+            SC_REPORT_FATAL("Gem5PacketPlayer", "Trace does not contain a header");
+
+        // PacketHeader: obj_id = 1, ver = 2, tick_freq = 3
+        uint64_t tickFrequency = 0;
+        Gem5ProtoReader::Field field;
+        while (reader.nextField(field))
+        {
+            if (field.number == 3)
+                tickFrequency = field.value;
+        }
+        if (tickFrequency == 0)
+            SC_REPORT_FATAL("Gem5PacketPlayer", "Trace does not define a tick frequency");
+        tickPeriod = sc_time(1.0 / tickFrequency, SC_SEC);
+
+        burstlength = Configuration::getInstance().memSpec->burstLength;
+        dataLength = Configuration::getInstance().getBytesPerBurst();
+    }
+
+    void nextPayload()
+    {
+        if (!reader.readMessage())
+        {
+            // The trace is finished. Nothing more to do.
+            this->finish();
+            return;
+        }
+
+        // Packet: tick = 1, cmd = 2, addr = 3, size = 4, flags = 5, pkt_id = 6, pc = 7
+        uint64_t tick = 0;
+        uint64_t command = 0;
+        uint64_t address = 0;
+        Gem5ProtoReader::Field field;
+        while (reader.nextField(field))
+        {
+            if (field.number == 1)
+                tick = field.value;
+            else if (field.number == 2)
+                command = field.value;
+            else if (field.number == 3)
+                address = field.value;
+        }
+
+        numberOfTransactions++;
+
+        // Allocate a generic payload for this request.
+        tlm::tlm_generic_payload *payload = this->allocatePayload();
+        payload->acquire();
+
+        // Fill up the payload.
+        payload->set_address(address);
+        payload->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        payload->set_dmi_allowed(false);
+        payload->set_byte_enable_length(0);
+        payload->set_streaming_width(burstlength);
+        payload->set_data_length(dataLength);
+        payload->set_command(isWrite(command) ? tlm::TLM_WRITE_COMMAND : tlm::TLM_READ_COMMAND);
+
+        // Send the transaction directly or schedule it to be sent in the future.
+        sc_time sendingTime = tick * tickPeriod + closedLoopDelay;
+        if (sendingTime <= sc_time_stamp())
+            this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
+        else
+            this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, sendingTime - sc_time_stamp());
+    }
+
+    static uint64_t getNumberOfPackets(std::string pathToTrace)
+    {
+        Gem5ProtoReader counter(pathToTrace);
+        uint64_t numberOfMessages = 0;
+        while (counter.readMessage())
+            numberOfMessages++;
+        // The first message is the header
+        return numberOfMessages > 0 ? numberOfMessages - 1 : 0;
+    }
+
+private:
+    // gem5 MemCmd: WriteReq = 4, WritebackDirty = 7, WritebackClean = 8, WriteClean = 9
+    static bool isWrite(uint64_t command)
+    {
+        return command == 4 || command == 7 || command == 8 || command == 9;
+    }
+
+    Gem5ProtoReader reader;
+    sc_time tickPeriod;
+    unsigned int burstlength;
+    unsigned int dataLength;
+};
+
+#endif // GEM5PACKETPLAYER_H
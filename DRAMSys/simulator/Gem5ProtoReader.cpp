@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#include "Gem5ProtoReader.h"
+#include <systemc>
+
+namespace
+{
+// "gem5" as little-endian 32 bit number
+const uint32_t gem5Magic = 0x356d6567;
+
+enum WireType : uint32_t {Varint = 0, Fixed64 = 1, LengthDelimited = 2, Fixed32 = 5};
+}
+
+Gem5ProtoReader::Gem5ProtoReader(const std::string &pathToTrace)
+    : file(nullptr), pathToTrace(pathToTrace)
+{
+    if (DecompressionBuffer::isCompressed(pathToTrace))
+    {
+        decompressionBuffer.reset(new DecompressionBuffer(pathToTrace));
+        file.rdbuf(decompressionBuffer.get());
+    }
+    else
+    {
+        plainFile.open(pathToTrace, std::ios::binary);
+        if (!plainFile.is_open())
+            SC_REPORT_FATAL("Gem5ProtoReader", ("Could not open trace " + pathToTrace).c_str());
+        file.rdbuf(plainFile.rdbuf());
+    }
+
+    unsigned char magic[4];
+    file.read(reinterpret_cast<char *>(magic), sizeof(magic));
+    uint32_t magicNumber = magic[0] | (magic[1] << 8) | (magic[2] << 16) | (static_cast<uint32_t>(magic[3]) << 24);
+    if (!file || magicNumber != gem5Magic)
+        SC_REPORT_FATAL("Gem5ProtoReader", (pathToTrace + " is not a gem5 protobuf trace").c_str());
+}
+
+bool Gem5ProtoReader::readMessage()
+{
+    // The size of each message is encoded as varint in front of it
+    uint64_t size = 0;
+    for (unsigned shift = 0; ; shift += 7)
+    {
+        int byte = file.get();
+        if (byte == std::char_traits<char>::eof())
+        {
+            if (shift != 0)
+                SC_REPORT_FATAL("Gem5ProtoReader", (pathToTrace + " is truncated").c_str());
+            if (decompressionBuffer != nullptr && !decompressionBuffer->getError().empty())
+                SC_REPORT_FATAL("Gem5ProtoReader", ("Could not decompress " + pathToTrace + ": "
+                                                    + decompressionBuffer->getError()).c_str());
+            return false;
+        }
+        if (shift > 28)
+            SC_REPORT_FATAL("Gem5ProtoReader", (pathToTrace + " contains an invalid message size").c_str());
+        size |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+            break;
+    }
+
+    message.resize(size);
+    file.read(message.data(), static_cast<std::streamsize>(size));
+    if (static_cast<uint64_t>(file.gcount()) != size)
+        SC_REPORT_FATAL("Gem5ProtoReader", (pathToTrace + " is truncated").c_str());
+
+    position = message.data();
+    end = message.data() + size;
+    return true;
+}
+
+bool Gem5ProtoReader::nextField(Field &field)
+{
+    if (position == end)
+        return false;
+
+    uint64_t key;
+    if (!readVarint(position, end, key))
+        SC_REPORT_FATAL("Gem5ProtoReader", (pathToTrace + " contains a malformed message").c_str());
+    field.number = static_cast<uint32_t>(key >> 3);
+    field.wireType = static_cast<uint32_t>(key & 0x7);
+    field.value = 0;
+    field.data = nullptr;
+    field.length = 0;
+
+    bool valid = true;
+    if (field.wireType == Varint)
+        valid = readVarint(position, end, field.value);
+    else if (field.wireType == LengthDelimited)
+    {
+        uint64_t length;
+        valid = readVarint(position, end, length) && length <= static_cast<uint64_t>(end - position);
+        if (valid)
+        {
+            field.data = position;
+            field.length = length;
+            position += length;
+        }
+    }
+    else if (field.wireType == Fixed64 || field.wireType == Fixed32)
+    {
+        size_t size = (field.wireType == Fixed64) ? 8 : 4;
+        valid = size <= static_cast<size_t>(end - position);
+        for (size_t i = 0; valid && i < size; i++)
+            field.value |= static_cast<uint64_t>(static_cast<unsigned char>(position[i])) << (8 * i);
+        if (valid)
+            position += size;
+    }
+    else
+        valid = false;
+
+    if (!valid)
+        SC_REPORT_FATAL("Gem5ProtoReader", (pathToTrace + " contains a malformed message").c_str());
+    return true;
+}
+
+bool Gem5ProtoReader::readVarint(const char *&position, const char *end, uint64_t &value)
+{
+    value = 0;
+    for (unsigned shift = 0; position != end && shift < 64; shift += 7)
+    {
+        unsigned char byte = static_cast<unsigned char>(*position);
+        position++;
+        value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
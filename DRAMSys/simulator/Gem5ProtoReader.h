@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef GEM5PROTOREADER_H
+#define GEM5PROTOREADER_H
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "DecompressionBuffer.h"
+
+// Reads the protobuf streams written by gem5 (packet traces and elastic traces) without
+// the protobuf library. A stream starts with the magic number "gem5" and is followed by
+// length-delimited messages, the first one is the header.
+class Gem5ProtoReader
+{
+public:
+    struct Field
+    {
+        uint32_t number;
+        uint32_t wireType;
+        // Value of varint and fixed fields
+        uint64_t value;
+        // Content of length-delimited fields (strings, nested messages, packed repeated fields)
+        const char *data;
+        size_t length;
+    };
+
+    explicit Gem5ProtoReader(const std::string &pathToTrace);
+
+    // Reads the next message, returns false at the end of the stream
+    bool readMessage();
+    // Returns the next field of the current message, returns false at the end of the message
+    bool nextField(Field &field);
+
+    // Decodes a varint and advances the position, returns false if the varint is incomplete
+    static bool readVarint(const char *&position, const char *end, uint64_t &value);
+
+private:
+    std::ifstream plainFile;
+    std::unique_ptr<DecompressionBuffer> decompressionBuffer;
+    std::istream file;
+    std::string pathToTrace;
+
+    std::vector<char> message;
+    const char *position = nullptr;
+    const char *end = nullptr;
+};
+
+#endif // GEM5PROTOREADER_H
@@ -46,10 +46,14 @@ MemoryManager::MemoryManager()
 
 MemoryManager::~MemoryManager()
 {
-    for (tlm_generic_payload *payload : freePayloads) {
-        delete[] payload->get_data_ptr();
-        delete payload;
-        numberOfFrees++;
+    for (auto &payloads : freePayloads) {
+        for (tlm_generic_payload *payload : payloads.second) {
+            BufferExtension *extension = nullptr;
+            payload->get_extension(extension);
+            delete[] extension->buffer;
+            delete payload; // also deletes the extension
+            numberOfFrees++;
+        }
     }
 
     // Comment in if you are suspecting a memory leak in the manager
@@ -59,27 +63,52 @@ MemoryManager::~MemoryManager()
 
 tlm_generic_payload *MemoryManager::allocate()
 {
-    if (freePayloads.empty()) {
+    return allocate(Configuration::getInstance().getBytesPerBurst());
+}
+
+tlm_generic_payload *MemoryManager::allocate(unsigned int dataLength)
+{
+    std::vector<tlm_generic_payload *> &payloads = freePayloads[dataLength];
+    if (payloads.empty()) {
         numberOfAllocations++;
         tlm_generic_payload *payload = new tlm_generic_payload(this);
 
         // Allocate a data buffer and initialize it with zeroes:
-        unsigned int dataLength = Configuration::getInstance().getBytesPerBurst();
         unsigned char *data = new unsigned char[dataLength];
         std::fill(data, data + dataLength, 0);
 
         payload->set_data_ptr(data);
+        payload->set_data_length(dataLength);
+        payload->set_extension(new BufferExtension(data, dataLength));
         return payload;
     } else {
-        tlm_generic_payload *result = freePayloads.back();
-        freePayloads.pop_back();
+        tlm_generic_payload *result = payloads.back();
+        payloads.pop_back();
         return result;
     }
 }
 
 void MemoryManager::free(tlm_generic_payload *payload)
 {
-    payload->reset(); // clears all extensions
-    freePayloads.push_back(payload);
+    payload->reset(); // clears all auto extensions
+
+    // The payload is filed under the size of its own buffer, not its current data length
+    BufferExtension *extension = nullptr;
+    payload->get_extension(extension);
+    payload->set_data_ptr(extension->buffer);
+    payload->set_data_length(extension->size);
+    freePayloads[extension->size].push_back(payload);
+}
+
+tlm_extension_base *MemoryManager::BufferExtension::clone() const
+{
+    return new BufferExtension(buffer, size);
+}
+
+void MemoryManager::BufferExtension::copy_from(const tlm_extension_base &ext)
+{
+    const BufferExtension &cpyFrom = static_cast<const BufferExtension &>(ext);
+    buffer = cpyFrom.buffer;
+    size = cpyFrom.size;
 }
 
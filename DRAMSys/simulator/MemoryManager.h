@@ -39,6 +39,7 @@
 
 #include <tlm.h>
 #include <vector>
+#include <map>
 
 class MemoryManager : public tlm::tlm_mm_interface
 {
@@ -46,12 +47,29 @@ public:
     MemoryManager();
     virtual ~MemoryManager();
     virtual tlm::tlm_generic_payload *allocate();
+    // Allocates a payload with a data buffer of dataLength bytes
+    tlm::tlm_generic_payload *allocate(unsigned int dataLength);
     virtual void free(tlm::tlm_generic_payload *payload);
 
 private:
+    // Remembers the data buffer of a payload, initiators and the ECC controller may change
+    // the data pointer and length before the payload is released.
+    // Like the DRAM extensions, it stays attached to the payload when it is reused.
+    class BufferExtension : public tlm::tlm_extension<BufferExtension>
+    {
+    public:
+        BufferExtension(unsigned char *buffer, unsigned int size) : buffer(buffer), size(size) {}
+        virtual tlm::tlm_extension_base *clone() const override;
+        virtual void copy_from(const tlm::tlm_extension_base &ext) override;
+
+        unsigned char *buffer;
+        unsigned int size;
+    };
+
     unsigned int numberOfAllocations;
     unsigned int numberOfFrees;
-    std::vector<tlm::tlm_generic_payload *> freePayloads;
+    // Free payloads by the size of their data buffer
+    std::map<unsigned int, std::vector<tlm::tlm_generic_payload *>> freePayloads;
 };
 
 #endif // MEMORYMANAGER_H
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+
+// Lock-free queue for exactly one producer thread and one consumer thread.
+// The capacity must be a power of two, the queue holds up to capacity - 1 elements.
+template<typename T, size_t capacity>
+class SpscQueue
+{
+    static_assert((capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    bool push(const T &element)
+    {
+        size_t tail = writeIndex.load(std::memory_order_relaxed);
+        size_t nextTail = (tail + 1) & (capacity - 1);
+        if (nextTail == readIndex.load(std::memory_order_acquire))
+            return false;
+        elements[tail] = element;
+        writeIndex.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &element)
+    {
+        size_t head = readIndex.load(std::memory_order_relaxed);
+        if (head == writeIndex.load(std::memory_order_acquire))
+            return false;
+        element = elements[head];
+        readIndex.store((head + 1) & (capacity - 1), std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::array<T, capacity> elements;
+    std::atomic<size_t> readIndex{0};
+    std::atomic<size_t> writeIndex{0};
+};
+
+#endif // SPSCQUEUE_H
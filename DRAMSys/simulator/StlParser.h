@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+#ifndef STLPARSER_H
+#define STLPARSER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Allocation-free helpers to parse the lines of STL traces, shared by the StlPlayer and the
+// mapping explorer
+class StlParser
+{
+public:
+    // Returns the next whitespace separated token of the line (tokenLength is 0 if there is none)
+    static void nextToken(const char *&position, const char *end,
+                          const char *&token, size_t &tokenLength)
+    {
+        while (position != end && (*position == ' ' || *position == '\t' || *position == '\r'))
+            position++;
+        token = position;
+        while (position != end && *position != ' ' && *position != '\t' && *position != '\r')
+            position++;
+        tokenLength = position - token;
+    }
+
+    // Parses the leading decimal digits of the token, trailing characters (e.g. ':') are ignored
+    static bool parseDecimal(const char *token, size_t tokenLength, uint64_t &value)
+    {
+        size_t i = 0;
+        value = 0;
+        while (i < tokenLength && token[i] >= '0' && token[i] <= '9')
+        {
+            value = value * 10 + (token[i] - '0');
+            i++;
+        }
+        return i > 0;
+    }
+
+    // Parses a hexadecimal number with optional 0x prefix
+    static bool parseHex(const char *token, size_t tokenLength, uint64_t &value)
+    {
+        size_t i = 0;
+        if (tokenLength > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X'))
+            i = 2;
+        size_t firstDigit = i;
+        value = 0;
+        while (i < tokenLength)
+        {
+            int8_t nibble = hexTable()[static_cast<unsigned char>(token[i])];
+            if (nibble < 0)
+                break;
+            value = (value << 4) | static_cast<uint64_t>(nibble);
+            i++;
+        }
+        return i > firstDigit;
+    }
+
+    // Decodes numberOfBytes pairs of hexadecimal characters into bytes
+    static bool decodeHexData(const char *characters, size_t numberOfBytes, unsigned char *bytes)
+    {
+        const std::array<int8_t, 256> &table = hexTable();
+        int8_t invalid = 0;
+        for (size_t i = 0; i < numberOfBytes; i++)
+        {
+            int8_t high = table[static_cast<unsigned char>(characters[2 * i])];
+            int8_t low = table[static_cast<unsigned char>(characters[2 * i + 1])];
+            // Invalid characters are marked with -1, so the sign bit is collected without a branch
+            invalid |= high | low;
+            bytes[i] = static_cast<unsigned char>(((high & 0xf) << 4) | (low & 0xf));
+        }
+        return invalid >= 0;
+    }
+
+private:
+    // Maps each character to its hexadecimal value or -1
+    static const std::array<int8_t, 256> &hexTable()
+    {
+        static const std::array<int8_t, 256> table = []()
+        {
+            std::array<int8_t, 256> table;
+            table.fill(-1);
+            for (int i = 0; i < 10; i++)
+                table['0' + i] = static_cast<int8_t>(i);
+            for (int i = 0; i < 6; i++)
+            {
+                table['a' + i] = static_cast<int8_t>(10 + i);
+                table['A' + i] = static_cast<int8_t>(10 + i);
+            }
+            return table;
+        }();
+        return table;
+    }
+};
+
+#endif // STLPARSER_H
@@ -40,17 +40,45 @@
 #ifndef STLPLAYER_H
 #define STLPLAYER_H
 
-#include <sstream>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "TracePlayer.h"
+#include "SpscQueue.h"
+#include "DecompressionBuffer.h"
+#include "StlParser.h"
 
 struct LineContent
 {
-    sc_time sendingTime;
+    uint64_t cycle;
     tlm::tlm_command cmd;
     uint64_t addr;
-    std::vector<unsigned char> data;
+    // Number of bytes, a multiple of the burst size (requests longer than one burst are split by the arbiter)
+    unsigned int dataLength;
+    // Offset of the write data in the data arena of the chunk
+    size_t dataOffset;
+    bool hasData;
+    // Distance to an earlier transaction that has to complete first (0 = none)
+    unsigned int dependency;
 };
 
+struct TraceChunk
+{
+    std::vector<LineContent> lineContents;
+    // Write data of all lines stored contiguously, capacity is kept when the chunk is reused
+    std::vector<unsigned char> dataArena;
+    // Error message if the parsing failed, the chunk contains the lines before the error
+    std::string error;
+    // True if the end of the file was reached
+    bool last = false;
+};
+
+// The trace file is parsed in chunks by a background thread while the simulation
+// consumes the previously parsed chunk. The chunks are recycled between the threads
+// through two lock-free queues, a thread only sleeps if there is no chunk to work on.
 template<bool relative>
 class StlPlayer : public TracePlayer
 {
@@ -60,159 +88,317 @@ public:
               sc_time playerClk,
               TracePlayerListener *listener) :
         TracePlayer(name, listener),
-        file(pathToTrace)
+        file(nullptr)
     {
-        if (!file.is_open())
-            SC_REPORT_FATAL(0, (std::string("Could not open trace ") + pathToTrace).c_str());
+        // Compressed traces are decompressed by the helper thread of the DecompressionBuffer
+        if (DecompressionBuffer::isCompressed(pathToTrace))
+        {
+            decompressionBuffer.reset(new DecompressionBuffer(pathToTrace));
+            file.rdbuf(decompressionBuffer.get());
+        }
+        else
+        {
+            plainFile.open(pathToTrace);
+            if (!plainFile.is_open())
+                SC_REPORT_FATAL(0, (std::string("Could not open trace ") + pathToTrace).c_str());
+            file.rdbuf(plainFile.rdbuf());
+        }
 
         this->playerClk = playerClk;
         burstlength = Configuration::getInstance().memSpec->burstLength;
         dataLength = Configuration::getInstance().getBytesPerBurst();
         lineCnt = 0;
 
-        parseTraceFile();
+        for (auto &chunk : chunks)
+            freeChunks.push(&chunk);
+        parserThread = std::thread(&StlPlayer::parserLoop, this);
+    }
+
+    virtual ~StlPlayer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(chunkMutex);
+            stopParser = true;
+        }
+        chunkCondition.notify_all();
+        parserThread.join();
     }
 
-    void parseTraceFile()
+    void nextPayload()
+    {
+        if (traceFinished)
+            return;
+
+        while (currentChunk == nullptr || lineIterator == currentChunk->lineContents.cend())
+        {
+            if (currentChunk != nullptr)
+            {
+                bool last = currentChunk->last;
+                putChunk(freeChunks, currentChunk);
+                currentChunk = nullptr;
+                if (last)
+                {
+                    // The file is finished. Nothing more to do.
+                    traceFinished = true;
+                    this->finish();
+                    return;
+                }
+            }
+
+            // Take the next parsed chunk, this only blocks if the parser thread is behind.
+            currentChunk = takeChunk(readyChunks);
+            if (!currentChunk->error.empty())
+                SC_REPORT_FATAL("StlPlayer", currentChunk->error.c_str());
+            lineIterator = currentChunk->lineContents.cbegin();
+        }
+
+        numberOfTransactions++;
+
+        // Allocate a generic payload for this request.
+        tlm::tlm_generic_payload *payload = this->allocatePayload(lineIterator->dataLength);
+        payload->acquire();
+
+        // Fill up the payload.
+        payload->set_address(lineIterator->addr);
+        payload->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        payload->set_dmi_allowed(false);
+        payload->set_byte_enable_length(0);
+        payload->set_streaming_width(burstlength);
+        payload->set_data_length(lineIterator->dataLength);
+        payload->set_command(lineIterator->cmd);
+        if (lineIterator->hasData)
+            std::memcpy(payload->get_data_ptr(), currentChunk->dataArena.data() + lineIterator->dataOffset,
+                        lineIterator->dataLength);
+
+        this->setDependency(lineIterator->dependency);
+        sc_time sendingTime = lineIterator->cycle * playerClk;
+        if (relative == false)
+        {
+            sendingTime += closedLoopDelay;
+            // Send the transaction directly or schedule it to be sent in the future.
+            if (sendingTime <= sc_time_stamp())
+                this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
+            else
+                this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ,
+                                               sendingTime - sc_time_stamp());
+        }
+        else
+            payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, sendingTime);
+
+        lineIterator++;
+    }
+
+private:
+    // Parses up to 10000 transactions into the chunk (runs in the parser thread).
+    // The line buffer and the chunk vectors keep their capacity, so no memory is
+    // allocated once the first chunks have been parsed.
+    void parseTraceFile(TraceChunk &chunk)
     {
-        std::string line;
         unsigned parsedLines = 0;
-        lineContents.clear();
+        chunk.lineContents.clear();
+        chunk.dataArena.clear();
+        chunk.error.clear();
+        chunk.last = false;
         while (file && !file.eof() && parsedLines < 10000)
         {
             // Get a new line from the input file.
             std::getline(file, line);
             lineCnt++;
             // If the line starts with '#' (commented lines) the transaction is ignored.
-            if (line.empty() || line.at(0) == '#')
+            if (line.empty() || line[0] == '#')
                 continue;
 
             parsedLines++;
-            lineContents.emplace_back();
-            LineContent &content = lineContents.back();
+            chunk.lineContents.emplace_back();
+            LineContent &content = chunk.lineContents.back();
+            content.dataLength = dataLength;
+            content.hasData = false;
+            content.dependency = 0;
 
             // Trace files MUST provide timestamp, command and address for every
             // transaction. The data information depends on the storage mode
             // configuration.
-            std::string time;
-            std::string command;
-            std::string address;
-            std::string dataStr;
-
-            std::istringstream iss(line);
+            const char *position = line.data();
+            const char *end = line.data() + line.size();
+            const char *token;
+            size_t tokenLength;
 
-            // Get the timestamp for the transaction.
-            iss >> time;
-            if (time.empty())
-                SC_REPORT_FATAL("StlPlayer",
-                ("Malformed trace file. Timestamp could not be found (line " + std::to_string(
-                    lineCnt) + ").").c_str());
-            content.sendingTime = std::stoull(time.c_str()) * playerClk;
+            // Get the timestamp for the transaction (e.g. "31:").
+            StlParser::nextToken(position, end, token, tokenLength);
+            if (!StlParser::parseDecimal(token, tokenLength, content.cycle))
+            {
+                chunk.error = "Malformed trace file. Timestamp could not be found (line "
+                        + std::to_string(lineCnt) + ").";
+                break;
+            }
 
             // Get the command.
-            iss >> command;
-            if (command.empty())
-                SC_REPORT_FATAL("StlPlayer",
-                ("Malformed trace file. Command could not be found (line " + std::to_string(
-                    lineCnt) + ").").c_str());
+            StlParser::nextToken(position, end, token, tokenLength);
+            if (tokenLength == 0)
+            {
+                chunk.error = "Malformed trace file. Command could not be found (line "
+                        + std::to_string(lineCnt) + ").";
+                break;
+            }
 
-            if (command == "read")
+            if (tokenLength == 4 && std::memcmp(token, "read", 4) == 0)
                 content.cmd = tlm::TLM_READ_COMMAND;
-            else if (command == "write")
+            else if (tokenLength == 5 && std::memcmp(token, "write", 5) == 0)
                 content.cmd = tlm::TLM_WRITE_COMMAND;
             else
-                SC_REPORT_FATAL("StlPlayer",
-                    (std::string("Corrupted tracefile, command ") + command +
-                        std::string(" unknown")).c_str());
+            {
+                chunk.error = "Corrupted tracefile, command " + std::string(token, tokenLength)
+                        + " unknown";
+                break;
+            }
 
             // Get the address.
-            iss >> address;
-            if (address.empty())
-                SC_REPORT_FATAL("StlPlayer",
-                ("Malformed trace file. Address could not be found (line "
-                    + std::to_string(lineCnt) + ").").c_str());
-            content.addr = std::stoull(address.c_str(), nullptr, 16);
+            StlParser::nextToken(position, end, token, tokenLength);
+            if (!StlParser::parseHex(token, tokenLength, content.addr))
+            {
+                chunk.error = "Malformed trace file. Address could not be found (line "
+                        + std::to_string(lineCnt) + ").";
+                break;
+            }
 
             // Get the data if necessary.
+            const char *dataToken = nullptr;
+            size_t dataTokenLength = 0;
             if (storageEnabled && content.cmd == tlm::TLM_WRITE_COMMAND)
             {
                 // The input trace file must provide the data to be stored into the memory.
-                iss >> dataStr;
-                if (dataStr.empty())
-                    SC_REPORT_FATAL("StlPlayer",
-                    ("Malformed trace file. Data information could not be found (line " + std::to_string(
-                        lineCnt) + ").").c_str());
+                StlParser::nextToken(position, end, dataToken, dataTokenLength);
+                if (dataTokenLength == 0)
+                {
+                    chunk.error = "Malformed trace file. Data information could not be found (line "
+                            + std::to_string(lineCnt) + ").";
+                    break;
+                }
+            }
+
+            // Get the optional annotations, the length in bytes (e.g. "len=128")
+            // and the dependency (e.g. "dep=2").
+            StlParser::nextToken(position, end, token, tokenLength);
+            while (tokenLength != 0)
+            {
+                uint64_t value;
+                if (tokenLength > 4 && std::memcmp(token, "dep=", 4) == 0)
+                {
+                    if (!StlParser::parseDecimal(token + 4, tokenLength - 4, value))
+                        break;
+                    content.dependency = static_cast<unsigned int>(value);
+                }
+                else if (tokenLength > 4 && std::memcmp(token, "len=", 4) == 0)
+                {
+                    if (!StlParser::parseDecimal(token + 4, tokenLength - 4, value)
+                            || value == 0 || value % dataLength != 0)
+                        break;
+                    content.dataLength = static_cast<unsigned int>(value);
+                }
+                StlParser::nextToken(position, end, token, tokenLength);
+            }
+            if (tokenLength != 0)
+            {
+                chunk.error = "Malformed trace file. Invalid annotation " + std::string(token, tokenLength)
+                        + " (line " + std::to_string(lineCnt) + "), a length must be a multiple of "
+                        + std::to_string(dataLength) + " bytes.";
+                break;
+            }
 
+            if (dataToken != nullptr)
+            {
                 // Check if data length in the trace file is correct.
                 // We need two characters to represent 1 byte in hexadecimal. Offset for 0x prefix.
-                if (dataStr.length() != (dataLength * 2 + 2))
-                    SC_REPORT_FATAL("StlPlayer",
-                    ("Data in the trace file has an invalid length (line " + std::to_string(
-                        lineCnt) + ").").c_str());
-
-                // Set data
-                for (unsigned i = 0; i < dataLength; i++)
-                    content.data.emplace_back((unsigned char)std::stoi(dataStr.substr(i * 2 + 2, 2).c_str(), nullptr, 16));
+                if (dataTokenLength != (content.dataLength * 2 + 2))
+                {
+                    chunk.error = "Data in the trace file has an invalid length (line "
+                            + std::to_string(lineCnt) + ").";
+                    break;
+                }
+
+                // Decode the data directly into the arena of the chunk.
+                content.dataOffset = chunk.dataArena.size();
+                content.hasData = true;
+                chunk.dataArena.resize(content.dataOffset + content.dataLength);
+                if (!StlParser::decodeHexData(dataToken + 2, content.dataLength,
+                                              &chunk.dataArena[content.dataOffset]))
+                {
+                    chunk.error = "Data in the trace file contains invalid characters (line "
+                            + std::to_string(lineCnt) + ").";
+                    break;
+                }
             }
         }
-        lineIterator = lineContents.cbegin();
+
+        if (!file || file.eof())
+        {
+            chunk.last = true;
+            if (decompressionBuffer != nullptr && chunk.error.empty()
+                    && !decompressionBuffer->getError().empty())
+                chunk.error = "Could not decompress trace file: " + decompressionBuffer->getError();
+        }
     }
 
-    void nextPayload()
+    void parserLoop()
     {
-        if (lineIterator == lineContents.cend())
+        while (true)
         {
-            // Read new lines of file.
-            parseTraceFile();
-            if (lineIterator == lineContents.cend())
-            {
-                // The file is empty. Nothing more to do.
-                this->finish();
+            TraceChunk *chunk = takeChunk(freeChunks);
+            if (chunk == nullptr)
                 return;
-            }
-        }
 
-        numberOfTransactions++;
+            parseTraceFile(*chunk);
+            putChunk(readyChunks, chunk);
 
-        // Allocate a generic payload for this request.
-        tlm::tlm_generic_payload *payload = this->allocatePayload();
-        payload->acquire();
+            if (chunk->last || !chunk->error.empty())
+                return;
+        }
+    }
 
-        // Fill up the payload.
-        payload->set_address(lineIterator->addr);
-        payload->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
-        payload->set_dmi_allowed(false);
-        payload->set_byte_enable_length(0);
-        payload->set_streaming_width(burstlength);
-        payload->set_data_length(dataLength);
-        payload->set_command(lineIterator->cmd);
-        std::copy(lineIterator->data.begin(), lineIterator->data.end(), payload->get_data_ptr());
+    // Blocks until a chunk is available (returns nullptr if the parser is stopped)
+    TraceChunk *takeChunk(SpscQueue<TraceChunk *, 4> &queue)
+    {
+        TraceChunk *chunk = nullptr;
+        if (queue.pop(chunk))
+            return chunk;
 
-        if (relative == false)
+        std::unique_lock<std::mutex> lock(chunkMutex);
+        chunkCondition.wait(lock, [&]() { return queue.pop(chunk) || stopParser; });
+        return chunk;
+    }
+
+    void putChunk(SpscQueue<TraceChunk *, 4> &queue, TraceChunk *chunk)
+    {
+        queue.push(chunk);
         {
-            // Send the transaction directly or schedule it to be sent in the future.
-            if (lineIterator->sendingTime <= sc_time_stamp())
-                this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
-            else
-                this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ,
-                                               lineIterator->sendingTime - sc_time_stamp());
+            // Taking the mutex ensures that a waiting thread does not miss the notification
+            std::lock_guard<std::mutex> lock(chunkMutex);
         }
-        else
-            payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, lineIterator->sendingTime);
-
-        lineIterator++;
+        chunkCondition.notify_all();
     }
 
-private:
-    std::ifstream file;
+    std::ifstream plainFile;
+    std::unique_ptr<DecompressionBuffer> decompressionBuffer;
+    std::istream file;
+    std::string line;
     unsigned int lineCnt;
 
     unsigned int burstlength;
     unsigned int dataLength;
     sc_time playerClk;  // May be different from the memory clock!
 
-    std::vector<LineContent> lineContents;
+    // Three chunks: one consumed by the simulation, one parsed and one ready in between
+    std::array<TraceChunk, 3> chunks;
+    SpscQueue<TraceChunk *, 4> freeChunks;
+    SpscQueue<TraceChunk *, 4> readyChunks;
+    std::thread parserThread;
+    std::mutex chunkMutex;
+    std::condition_variable chunkCondition;
+    bool stopParser = false;
+
+    TraceChunk *currentChunk = nullptr;
     std::vector<LineContent>::const_iterator lineIterator;
+    bool traceFinished = false;
 };
 
 #endif // STLPLAYER_H
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, Technische Universität Kaiserslautern
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: agent
+ */
+
+// Converts .stl and .rstl traces into the binary trace format (.btr) of the BinaryPlayer.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include "BinaryTrace.h"
+
+static void fail(const std::string &message, uint64_t lineNumber)
+{
+    std::cerr << "Error in line " << lineNumber << ": " << message << std::endl;
+    std::exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        std::cout << "Usage: " << argv[0] << " <input.stl|input.rstl> <output.btr>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string inputName = argv[1];
+    std::string extension = inputName.substr(inputName.rfind('.') + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    if (extension != "stl" && extension != "rstl")
+    {
+        std::cerr << "Unsupported file extension in " << inputName << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(inputName);
+    if (!input.is_open())
+    {
+        std::cerr << "Could not open trace " << inputName << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream output(argv[2], std::ios::binary);
+    if (!output.is_open())
+    {
+        std::cerr << "Could not create " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The records are streamed to the output behind a placeholder header, the write data is
+    // spooled to a temporary file and appended at the end, so the trace is never held in memory.
+    std::FILE *dataFile = std::tmpfile();
+    if (dataFile == nullptr)
+    {
+        std::cerr << "Could not create a temporary file for the write data" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    BinaryTraceHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, binaryTraceMagic, sizeof(binaryTraceMagic));
+    header.version = binaryTraceVersion;
+    header.relative = (extension == "rstl") ? 1 : 0;
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<unsigned char> data;
+    std::string line;
+    uint64_t lineNumber = 0;
+    while (std::getline(input, line))
+    {
+        lineNumber++;
+        if (line.empty() || line.at(0) == '#')
+            continue;
+
+        std::istringstream iss(line);
+        std::string time;
+        std::string command;
+        std::string address;
+        std::string dataString;
+        iss >> time >> command >> address >> dataString;
+
+        if (time.empty() || address.empty())
+            fail("Malformed trace line", lineNumber);
+        if (line.find("len=") != std::string::npos)
+            fail("Requests longer than one burst are not supported by the binary trace format", lineNumber);
+        if (line.find("dep=") != std::string::npos)
+            fail("Dependencies are not supported by the binary trace format", lineNumber);
+
+        BinaryTraceRecord record;
+        record.cycle = std::stoull(time);
+        record.address = std::stoull(address, nullptr, 16);
+        record.dataIndex = binaryTraceNoData;
+        if (command == "read")
+            record.command = 0;
+        else if (command == "write")
+            record.command = 1;
+        else
+            fail("Unknown command " + command, lineNumber);
+
+        if (record.command == 1 && dataString.compare(0, 2, "0x") == 0)
+        {
+            // Hexadecimal data with 0x prefix, two characters per byte
+            unsigned int dataLength = (dataString.length() - 2) / 2;
+            if (header.numberOfDataEntries == 0)
+                header.dataLength = dataLength;
+            else if (dataLength != header.dataLength)
+                fail("Data length differs from previous lines", lineNumber);
+
+            record.dataIndex = header.numberOfDataEntries++;
+            data.resize(dataLength);
+            for (unsigned int i = 0; i < dataLength; i++)
+                data[i] = static_cast<unsigned char>(std::stoi(dataString.substr(i * 2 + 2, 2), nullptr, 16));
+            if (std::fwrite(data.data(), 1, dataLength, dataFile) != dataLength)
+                fail("Could not write to the temporary file", lineNumber);
+        }
+
+        output.write(reinterpret_cast<const char *>(&record), sizeof(record));
+        header.numberOfTransactions++;
+    }
+
+    // Append the write data and fill in the final header
+    std::rewind(dataFile);
+    std::vector<char> buffer(1 << 20);
+    size_t bytesRead;
+    while ((bytesRead = std::fread(buffer.data(), 1, buffer.size(), dataFile)) > 0)
+        output.write(buffer.data(), bytesRead);
+    std::fclose(dataFile);
+
+    output.seekp(0);
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output.close();
+    if (!output)
+    {
+        std::cerr << "Could not write " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Converted " << header.numberOfTransactions << " transactions to " << argv[2] << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -38,50 +38,139 @@
 #ifndef TRACEGENERATOR_H
 #define TRACEGENERATOR_H
 
+#include <random>
 #include "TracePlayer.h"
+#include "common/AddressDecoder.h"
 
+struct GeneratorSetup
+{
+    std::string pattern;
+    uint64_t numberOfRequests = 0;
+    double readRatio = 1.0;
+    uint64_t seed = 0;
+    unsigned int channel = 0;
+    unsigned int rank = 0;
+};
+
+// Generates synthetic traffic with targeted access patterns. The addresses are created
+// from DRAM coordinates with the inverse address mapping, so no trace file is needed.
 struct TraceGenerator : public TracePlayer
 {
 public:
-    TraceGenerator(sc_module_name name, unsigned int fCKMhz, TracePlayerListener *listener)
-        : TracePlayer(name, listener), transCounter(0)
+    TraceGenerator(sc_module_name name, const GeneratorSetup &setup, sc_time playerClk,
+                   AddressDecoder *addressDecoder, TracePlayerListener *listener)
+        : TracePlayer(name, listener), setup(setup), playerClk(playerClk),
+          addressDecoder(addressDecoder), randomGenerator(setup.seed)
     {
-        if (fCKMhz == 0)
-            tCK = Configuration::getInstance().memSpec->tCK;
+        if (setup.pattern == "Random")
+            pattern = Pattern::Random;
+        else if (setup.pattern == "RowHits")
+            pattern = Pattern::RowHits;
+        else if (setup.pattern == "BankConflicts")
+            pattern = Pattern::BankConflicts;
+        else if (setup.pattern == "BankGroupPingPong")
+            pattern = Pattern::BankGroupPingPong;
         else
-            tCK = sc_time(1.0 / fCKMhz, SC_US);
+            SC_REPORT_FATAL("TraceGenerator", ("Unsupported pattern " + setup.pattern).c_str());
+
+        memSpec = Configuration::getInstance().memSpec;
+        if (setup.channel >= memSpec->numberOfChannels || setup.rank >= memSpec->numberOfRanks)
+            SC_REPORT_FATAL("TraceGenerator", "Channel or rank out of range");
 
-        this->burstlenght = Configuration::getInstance().memSpec->burstLength;
+        dataLength = Configuration::getInstance().getBytesPerBurst();
+        burstsPerRow = memSpec->numberOfColumns / memSpec->burstLength;
     }
 
     virtual void nextPayload() override
     {
-        if (transCounter >= 1000) { // TODO set limit!
-            this->terminate();
+        if (transactionsGenerated == setup.numberOfRequests)
+        {
+            this->finish();
+            return;
         }
 
+        numberOfTransactions++;
+
         tlm::tlm_generic_payload *payload = this->allocatePayload();
         payload->acquire();
-        unsigned char *dataElement = new unsigned
-        char[16];  // TODO: column / burst breite
 
-        payload->set_address(0x0);
+        // The arbiter subtracts the address offset from all incoming requests
+        payload->set_address(addressDecoder->encodeAddress(nextAddress())
+                             + Configuration::getInstance().addressOffset);
         payload->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
         payload->set_dmi_allowed(false);
         payload->set_byte_enable_length(0);
-        payload->set_streaming_width(this->burstlenght);
-        payload->set_data_ptr(dataElement);
-        payload->set_data_length(16);
-        payload->set_command(tlm::TLM_READ_COMMAND);
-        transCounter++;
-        this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
+        payload->set_streaming_width(memSpec->burstLength);
+        payload->set_data_length(dataLength);
+        if (std::generate_canonical<double, 32>(randomGenerator) < setup.readRatio)
+            payload->set_command(tlm::TLM_READ_COMMAND);
+        else
+            payload->set_command(tlm::TLM_WRITE_COMMAND);
+
+        // The first request is sent immediately, all further ones one clock cycle after the acceptance of the previous one.
+        if (transactionsGenerated == 0)
+            this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, SC_ZERO_TIME);
+        else
+            this->payloadEventQueue.notify(*payload, tlm::BEGIN_REQ, playerClk);
+        transactionsGenerated++;
     }
 
 private:
-    unsigned int burstlenght;
-    sc_time tCK;
-    unsigned int transCounter;
+    enum class Pattern {Random, RowHits, BankConflicts, BankGroupPingPong} pattern;
+    GeneratorSetup setup;
+    sc_time playerClk;
+    AddressDecoder *addressDecoder;
+    const MemSpec *memSpec;
+    std::mt19937_64 randomGenerator;
+    unsigned int dataLength;
+    unsigned int burstsPerRow;
+    uint64_t transactionsGenerated = 0;
+
+    DecodedAddress nextAddress()
+    {
+        uint64_t n = transactionsGenerated;
+        DecodedAddress decAddr;
+        decAddr.channel = setup.channel;
+        decAddr.rank = setup.rank;
+        unsigned int bankgroup = 0;
+        unsigned int bank = 0;
+
+        switch (pattern)
+        {
+        case Pattern::Random:
+            // Uniformly distributed over all channels, ranks, banks, rows and columns
+            decAddr.channel = randomGenerator() % memSpec->numberOfChannels;
+            decAddr.rank = randomGenerator() % memSpec->numberOfRanks;
+            bankgroup = randomGenerator() % memSpec->groupsPerRank;
+            bank = randomGenerator() % memSpec->banksPerGroup;
+            decAddr.row = randomGenerator() % memSpec->numberOfRows;
+            decAddr.column = (randomGenerator() % burstsPerRow) * memSpec->burstLength;
+            break;
+        case Pattern::RowHits:
+            // All bursts of a row, then the same row in the next bank, then the next row
+            decAddr.column = (n % burstsPerRow) * memSpec->burstLength;
+            n /= burstsPerRow;
+            bankgroup = (n % memSpec->banksPerRank) / memSpec->banksPerGroup;
+            bank = (n % memSpec->banksPerRank) % memSpec->banksPerGroup;
+            decAddr.row = (n / memSpec->banksPerRank) % memSpec->numberOfRows;
+            break;
+        case Pattern::BankConflicts:
+            // A different row of the same bank for every request
+            decAddr.row = n % memSpec->numberOfRows;
+            decAddr.column = 0;
+            break;
+        case Pattern::BankGroupPingPong:
+            // Row hits that alternate between the bank groups of the rank
+            bankgroup = n % memSpec->groupsPerRank;
+            decAddr.row = 0;
+            decAddr.column = ((n / memSpec->groupsPerRank) % burstsPerRow) * memSpec->burstLength;
+            break;
+        }
+
+        decAddr.bankgroup = decAddr.rank * memSpec->groupsPerRank + bankgroup;
+        decAddr.bank = decAddr.bankgroup * memSpec->banksPerGroup + bank;
+        return decAddr;
+    }
 };
 
 #endif // TRACEGENERATOR_H
-
@@ -58,6 +58,35 @@ tlm_generic_payload *TracePlayer::allocatePayload()
     return memoryManager.allocate();
 }
 
+tlm_generic_payload *TracePlayer::allocatePayload(unsigned int dataLength)
+{
+    return memoryManager.allocate(dataLength);
+}
+
+void TracePlayer::setPriority(unsigned int priority, unsigned int weight)
+{
+    priorityEnabled = true;
+    this->priority = priority;
+    this->weight = weight;
+}
+
+void TracePlayer::setClosedLoop(unsigned int maxOutstandingReads, unsigned int maxOutstandingWrites)
+{
+    closedLoop = true;
+    this->maxOutstandingReads = maxOutstandingReads;
+    this->maxOutstandingWrites = maxOutstandingWrites;
+
+    unsigned int ringSize = 64;
+    while (ringSize < maxOutstandingReads + maxOutstandingWrites)
+        ringSize *= 2;
+    outstandingRing = std::vector<bool>(ringSize, false);
+}
+
+void TracePlayer::setDependency(unsigned int distance)
+{
+    dependencyDistance = distance;
+}
+
 void TracePlayer::finish()
 {
     finished = true;
@@ -80,12 +109,41 @@ void TracePlayer::peqCallback(tlm_generic_payload &payload,
                               const tlm_phase &phase)
 {
     if (phase == BEGIN_REQ) {
-        sendToTarget(payload, phase, SC_ZERO_TIME);
-        transactionsSent++;
-        PRINTDEBUGMESSAGE(name(), "Performing request #" + std::to_string(transactionsSent));
+        if (closedLoop && !canIssue(payload))
+        {
+            // The next payload is only created after END_REQ, so at most one payload is stalled
+            stalledPayload = &payload;
+            stallStart = sc_time_stamp();
+            PRINTDEBUGMESSAGE(name(), "Stalling request #" + std::to_string(transactionsSent + 1));
+        }
+        else
+            issueRequest(payload);
     } else if (phase == END_REQ) {
         nextPayload();
     } else if (phase == BEGIN_RESP) {
+        if (closedLoop)
+        {
+            if (payload.is_read())
+                outstandingReads--;
+            else
+                outstandingWrites--;
+            TransactionNumberExtension *extension = nullptr;
+            payload.get_extension(extension);
+            uint64_t mask = outstandingRing.size() - 1;
+            outstandingRing[extension->number & mask] = false;
+            while (oldestOutstanding < transactionsSent && !outstandingRing[oldestOutstanding & mask])
+                oldestOutstanding++;
+
+            if (stalledPayload != nullptr && canIssue(*stalledPayload))
+            {
+                closedLoopDelay += sc_time_stamp() - stallStart;
+                tlm_generic_payload *payloadToIssue = stalledPayload;
+                stalledPayload = nullptr;
+                issueRequest(*payloadToIssue);
+            }
+        }
+
+        responseReceived(payload);
         payload.release();
         sendToTarget(payload, END_RESP, SC_ZERO_TIME);
         if (Configuration::getInstance().simulationProgressBar)
@@ -104,6 +162,73 @@ void TracePlayer::peqCallback(tlm_generic_payload &payload,
     }
 }
 
+bool TracePlayer::canIssue(const tlm_generic_payload &payload) const
+{
+    if (payload.is_read())
+    {
+        if (maxOutstandingReads != 0 && outstandingReads >= maxOutstandingReads)
+            return false;
+    }
+    else if (maxOutstandingWrites != 0 && outstandingWrites >= maxOutstandingWrites)
+        return false;
+
+    // The transaction that is dependencyDistance transactions older must be completed
+    if (dependencyDistance != 0 && dependencyDistance <= transactionsSent
+            && isOutstanding(transactionsSent - dependencyDistance))
+        return false;
+
+    return true;
+}
+
+bool TracePlayer::isOutstanding(uint64_t transaction) const
+{
+    return transaction >= oldestOutstanding && outstandingRing[transaction & (outstandingRing.size() - 1)];
+}
+
+void TracePlayer::issueRequest(tlm_generic_payload &payload)
+{
+    if (priorityEnabled)
+    {
+        // Not an auto extension, so it stays attached when the memory manager recycles the payload
+        PriorityExtension *extension = nullptr;
+        payload.get_extension(extension);
+        if (extension == nullptr)
+            payload.set_extension(new PriorityExtension(priority, weight));
+        else
+            *extension = PriorityExtension(priority, weight);
+    }
+
+    if (closedLoop)
+    {
+        if (payload.is_read())
+            outstandingReads++;
+        else
+            outstandingWrites++;
+        dependencyDistance = 0;
+
+        TransactionNumberExtension *extension = nullptr;
+        payload.get_extension(extension);
+        if (extension == nullptr)
+            payload.set_extension(new TransactionNumberExtension(transactionsSent));
+        else
+            extension->number = transactionsSent;
+
+        if (transactionsSent - oldestOutstanding >= outstandingRing.size())
+        {
+            // Double the ring, the entries keep their transaction numbers
+            std::vector<bool> newRing(outstandingRing.size() * 2, false);
+            for (uint64_t transaction = oldestOutstanding; transaction < transactionsSent; transaction++)
+                newRing[transaction & (newRing.size() - 1)] = isOutstanding(transaction);
+            outstandingRing.swap(newRing);
+        }
+        outstandingRing[transactionsSent & (outstandingRing.size() - 1)] = true;
+    }
+
+    sendToTarget(payload, BEGIN_REQ, SC_ZERO_TIME);
+    transactionsSent++;
+    PRINTDEBUGMESSAGE(name(), "Performing request #" + std::to_string(transactionsSent));
+}
+
 void TracePlayer::sendToTarget(tlm_generic_payload &payload, const tlm_phase &phase, const sc_time &delay)
 {
     tlm_phase TPhase = phase;
@@ -46,11 +46,31 @@
 #include <tlm_utils/peq_with_cb_and_phase.h>
 #include <iostream>
 #include <string>
+#include <vector>
 #include "MemoryManager.h"
 #include "configuration/Configuration.h"
 #include "common/DebugManager.h"
+#include "common/dramExtensions.h"
 #include "TracePlayerListener.h"
 
+// Number of a transaction within the trace, used in closed-loop mode. It is not an auto extension,
+// so it stays attached to the payload when the memory manager recycles it.
+class TransactionNumberExtension : public tlm::tlm_extension<TransactionNumberExtension>
+{
+public:
+    TransactionNumberExtension(uint64_t number) : number(number) {}
+    virtual tlm::tlm_extension_base *clone() const override
+    {
+        return new TransactionNumberExtension(number);
+    }
+    virtual void copy_from(const tlm::tlm_extension_base &ext) override
+    {
+        number = static_cast<const TransactionNumberExtension &>(ext).number;
+    }
+
+    uint64_t number;
+};
+
 struct TracePlayer : public sc_module
 {
 public:
@@ -58,14 +78,22 @@ public:
     TracePlayer(sc_module_name name, TracePlayerListener *listener);
     virtual void nextPayload() = 0;
     unsigned int getNumberOfLines(std::string pathToTrace);
+    void setPriority(unsigned int priority, unsigned int weight);
+    void setClosedLoop(unsigned int maxOutstandingReads, unsigned int maxOutstandingWrites);
 
 protected:
     tlm::tlm_generic_payload *allocatePayload();
+    tlm::tlm_generic_payload *allocatePayload(unsigned int dataLength);
     tlm_utils::peq_with_cb_and_phase<TracePlayer> payloadEventQueue;
     void finish();
     void terminate();
+    void setDependency(unsigned int distance);
+    // Called when the response of a transaction arrives, before the payload is released
+    virtual void responseReceived(tlm::tlm_generic_payload &) {}
     unsigned int numberOfTransactions = 0;
     bool storageEnabled = false;
+    // Time the closed-loop player was stalled, shifts all following absolute timestamps
+    sc_time closedLoopDelay = SC_ZERO_TIME;
 
 private:
     tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload &payload, tlm::tlm_phase &phase,
@@ -73,11 +101,34 @@ private:
     void peqCallback(tlm::tlm_generic_payload &payload, const tlm::tlm_phase &phase);
     void sendToTarget(tlm::tlm_generic_payload &payload, const tlm::tlm_phase &phase,
                       const sc_time &delay);
+    bool canIssue(const tlm::tlm_generic_payload &payload) const;
+    void issueRequest(tlm::tlm_generic_payload &payload);
     MemoryManager memoryManager;
     unsigned int transactionsSent = 0;
     unsigned int transactionsReceived = 0;
     TracePlayerListener *listener;
     bool finished = false;
+    bool priorityEnabled = false;
+    unsigned int priority = 0;
+    unsigned int weight = 1;
+
+    // Closed-loop mode: limited number of outstanding transactions (0 = unlimited)
+    // and optional dependencies on the completion of earlier transactions
+    bool closedLoop = false;
+    unsigned int maxOutstandingReads = 0;
+    unsigned int maxOutstandingWrites = 0;
+    unsigned int outstandingReads = 0;
+    unsigned int outstandingWrites = 0;
+    unsigned int dependencyDistance = 0;
+    tlm::tlm_generic_payload *stalledPayload = nullptr;
+    sc_time stallStart;
+    // Ring of the transactions from the oldest outstanding one to the last sent one, indexed by the
+    // transaction number modulo its size (a power of two). It is sized by the MLP limit and only grows
+    // if an old transaction is outstanding while many younger ones have completed.
+    std::vector<bool> outstandingRing;
+    uint64_t oldestOutstanding = 0;
+    bool isOutstanding(uint64_t transaction) const;
 };
 
+
 #endif // TRACEPLAYER_H
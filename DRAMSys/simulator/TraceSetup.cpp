@@ -63,53 +63,140 @@ TraceSetup::TraceSetup(std::string uri,
 
             std::string name = value["name"];
 
-            size_t pos = name.rfind('.');
-            if (pos == std::string::npos)
-                throw std::runtime_error("Name of the trace file does not contain a valid extension.");
-
-            // Get the extension and make it lower case
-            std::string ext = name.substr(pos + 1);
-            std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-            std::string stlFile =  pathToResources + std::string("traces/") + name;
-            std::string moduleName = name;
-
-            // replace all '.' to '_'
-            std::replace(moduleName.begin(), moduleName.end(), '.', '_');
-
             TracePlayer *player;
-            if (ext == "stl")
-                player = new StlPlayer<false>(moduleName.c_str(), stlFile, playerClk, this);
-            else if (ext == "rstl")
-                player = new StlPlayer<true>(moduleName.c_str(), stlFile, playerClk, this);
+            if (!value["pattern"].is_null())
+            {
+                // Synthetic traffic generator instead of a trace file
+                if (addressDecoder == nullptr)
+                    addressDecoder = new AddressDecoder(pathToResources + "configs/amconfigs/"
+                            + std::string(simulationdoc["simulation"]["addressmapping"]));
+
+                GeneratorSetup setup;
+                setup.pattern = value["pattern"];
+                if (value["requests"].is_null())
+                    SC_REPORT_FATAL("traceSetup", "No number of requests defined for generator");
+                setup.numberOfRequests = value["requests"];
+                if (setup.numberOfRequests == 0)
+                    SC_REPORT_FATAL("traceSetup", "The number of requests of a generator must be greater than 0");
+                if (!value["readRatio"].is_null())
+                    setup.readRatio = value["readRatio"];
+                if (!value["seed"].is_null())
+                    setup.seed = value["seed"];
+                if (!value["channel"].is_null())
+                    setup.channel = value["channel"];
+                if (!value["rank"].is_null())
+                    setup.rank = value["rank"];
+
+                player = new TraceGenerator(name.c_str(), setup, playerClk, addressDecoder, this);
+
+                if (Configuration::getInstance().simulationProgressBar)
+                    totalTransactions += setup.numberOfRequests;
+            }
             else
-                throw std::runtime_error("Unsupported file extension in " + name);
+            {
+                // Compressed traces are identified by the extension before the compression suffix
+                bool compressed = DecompressionBuffer::isCompressed(name);
+                std::string uncompressedName = DecompressionBuffer::removeCompressionExtension(name);
+                size_t pos = uncompressedName.rfind('.');
+                if (pos == std::string::npos)
+                    throw std::runtime_error("Name of the trace file does not contain a valid extension.");
+
+                // Get the extension and make it lower case
+                std::string ext = uncompressedName.substr(pos + 1);
+                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+                std::string stlFile =  pathToResources + std::string("traces/") + name;
+                std::string moduleName = name;
+
+                // replace all '.' to '_'
+                std::replace(moduleName.begin(), moduleName.end(), '.', '_');
+
+                if (ext == "stl")
+                    player = new StlPlayer<false>(moduleName.c_str(), stlFile, playerClk, this);
+                else if (ext == "rstl")
+                    player = new StlPlayer<true>(moduleName.c_str(), stlFile, playerClk, this);
+                else if (ext == "btr" && !compressed)
+                    player = new BinaryPlayer(moduleName.c_str(), stlFile, playerClk, this);
+                else if (ext == "inst")
+                    player = new Gem5PacketPlayer(moduleName.c_str(), stlFile, this);
+                else if (ext == "data")
+                    player = new ElasticTracePlayer(moduleName.c_str(), stlFile, this);
+                else
+                    throw std::runtime_error("Unsupported file extension in " + name);
+
+                if (Configuration::getInstance().simulationProgressBar)
+                {
+                    if (ext == "btr")
+                        totalTransactions += static_cast<BinaryPlayer *>(player)->getNumberOfRecords();
+                    else if (ext == "inst")
+                        totalTransactions += Gem5PacketPlayer::getNumberOfPackets(stlFile);
+                    else if (ext == "data")
+                        totalTransactions += ElasticTracePlayer::getNumberOfMemoryRecords(stlFile);
+                    else if (compressed)
+                        // Counting would decompress the whole trace once more, the progress is shown without a total
+                        totalKnown = false;
+                    else
+                        totalTransactions += player->getNumberOfLines(stlFile);
+                }
+            }
+
+            // Optional priority and weight for the arbitration between the trace players
+            if (!value["priority"].is_null() || !value["weight"].is_null())
+            {
+                unsigned int priority = value["priority"].is_null() ? 0 : (unsigned int)value["priority"];
+                unsigned int weight = value["weight"].is_null() ? 1 : (unsigned int)value["weight"];
+                if (weight == 0)
+                    SC_REPORT_FATAL("traceSetup", "Weight of a trace player must be greater than zero");
+                player->setPriority(priority, weight);
+            }
+
+            // Optional closed-loop mode with a limited number of outstanding transactions
+            if (!value["maxOutstandingReads"].is_null() || !value["maxOutstandingWrites"].is_null())
+            {
+                unsigned int maxOutstandingReads = value["maxOutstandingReads"].is_null()
+                        ? 0 : (unsigned int)value["maxOutstandingReads"];
+                unsigned int maxOutstandingWrites = value["maxOutstandingWrites"].is_null()
+                        ? 0 : (unsigned int)value["maxOutstandingWrites"];
+                player->setClosedLoop(maxOutstandingReads, maxOutstandingWrites);
+            }
 
             devices->push_back(player);
-
-            if (Configuration::getInstance().simulationProgressBar)
-                totalTransactions += player->getNumberOfLines(stlFile);
         }
     }
 
-    remainingTransactions = totalTransactions;
     numberOfTracePlayers = devices->size();
 }
 
+TraceSetup::~TraceSetup()
+{
+    delete addressDecoder;
+}
+
 void TraceSetup::tracePlayerTerminates()
 {
     finishedTracePlayers++;
 
     if (finishedTracePlayers == numberOfTracePlayers)
+    {
+        if (Configuration::getInstance().simulationProgressBar && !totalKnown)
+            std::cout << finishedTransactions << " transactions finished" << std::endl;
         sc_stop();
+    }
 }
 
 void TraceSetup::transactionFinished()
 {
-    remainingTransactions--;
+    finishedTransactions++;
+
+    if (!totalKnown)
+    {
+        if (finishedTransactions % 10000 == 0)
+            std::cout << finishedTransactions << " transactions finished\r" << std::flush;
+        return;
+    }
 
-    loadbar(totalTransactions - remainingTransactions, totalTransactions);
+    loadbar(finishedTransactions, totalTransactions);
 
-    if (remainingTransactions == 0)
+    if (finishedTransactions == totalTransactions)
         std::cout << std::endl;
 }
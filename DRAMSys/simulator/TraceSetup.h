@@ -42,6 +42,10 @@
 #include "common/utils.h"
 #include "TracePlayer.h"
 #include "StlPlayer.h"
+#include "TraceGenerator.h"
+#include "BinaryPlayer.h"
+#include "Gem5PacketPlayer.h"
+#include "ElasticTracePlayer.h"
 
 
 class TraceSetup : public TracePlayerListener
@@ -53,12 +57,16 @@ public:
 
     virtual void tracePlayerTerminates() override;
     virtual void transactionFinished() override;
-    virtual ~TraceSetup() {}
+    virtual ~TraceSetup();
 
 private:
+    // Address mapping used by the traffic generators
+    AddressDecoder *addressDecoder = nullptr;
     unsigned int numberOfTracePlayers;
     unsigned int totalTransactions = 0;
-    unsigned int remainingTransactions;
+    // False if a trace is compressed, its number of transactions is only known at the end
+    bool totalKnown = true;
+    unsigned int finishedTransactions = 0;
     unsigned int finishedTracePlayers = 0;
 };
 